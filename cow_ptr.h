@@ -0,0 +1,37 @@
+#ifndef COW_PTR_H
+#define COW_PTR_H
+
+#include <memory>
+
+/**
+ * Clase CowPtr - Puntero con copia en escritura (copy-on-write)
+ *
+ * Copiar un CowPtr solo comparte el objeto apuntado. La primera escritura
+ * desde una copia que comparte el objeto lo duplica, de modo que las demás
+ * copias no ven el cambio.
+ */
+template <typename T>
+class CowPtr {
+private:
+    std::shared_ptr<T> data;
+
+public:
+    CowPtr() : data(std::make_shared<T>()) {}
+    explicit CowPtr(const std::shared_ptr<T>& value) : data(value) {}
+
+    // Acceso de solo lectura: nunca copia
+    const T& read() const { return *data; }
+
+    // Acceso de escritura: duplica el objeto si está compartido
+    T& write() {
+        if (data.use_count() > 1) {
+            data = std::make_shared<T>(*data);
+        }
+        return *data;
+    }
+
+    // Indica si ambos punteros comparten el mismo objeto
+    bool sharesWith(const CowPtr& other) const { return data == other.data; }
+};
+
+#endif // COW_PTR_H
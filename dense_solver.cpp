@@ -0,0 +1,125 @@
+#include "dense_solver.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+const int DenseSolver::BLOCK_SIZE;
+const int DenseSolver::LANE_WIDTH;
+const int DenseSolver::INFINITE_DISTANCE;
+
+DenseSolver::DenseSolver(int nodes)
+    : numNodes(nodes),
+      stride((nodes + LANE_WIDTH - 1) / LANE_WIDTH * LANE_WIDTH),
+      distances(static_cast<size_t>(stride) * nodes, INFINITE_DISTANCE) {
+    for (int i = 0; i < numNodes; ++i) {
+        distances[static_cast<size_t>(i) * stride + i] = 0;
+    }
+}
+
+void DenseSolver::setEdge(int from, int to, int cost) {
+    size_t index = static_cast<size_t>(from) * stride + to;
+    distances[index] = std::min(distances[index], cost);
+}
+
+void DenseSolver::solve() {
+    int numBlocks = (numNodes + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    for (int k = 0; k < numBlocks; ++k) {
+        // Fase 1: bloque diagonal
+        relaxBlock(k, k, k);
+
+        // Fase 2: fila y columna del bloque k
+        for (int b = 0; b < numBlocks; ++b) {
+            if (b == k) continue;
+            relaxBlock(k, b, k);
+            relaxBlock(b, k, k);
+        }
+
+        // Fase 3: resto de bloques, que solo leen la fila y columna ya cerradas
+        for (int i = 0; i < numBlocks; ++i) {
+            if (i == k) continue;
+            for (int j = 0; j < numBlocks; ++j) {
+                if (j == k) continue;
+                relaxBlock(i, j, k);
+            }
+        }
+    }
+}
+
+void DenseSolver::relaxBlock(int iBlock, int jBlock, int kBlock) {
+    const int kStart = kBlock * BLOCK_SIZE;
+    const int kEnd = std::min(numNodes, kStart + BLOCK_SIZE);
+    const int iStart = iBlock * BLOCK_SIZE;
+    const int iEnd = std::min(numNodes, iStart + BLOCK_SIZE);
+    const int jStart = jBlock * BLOCK_SIZE;
+    const int jEnd = std::min(stride, jStart + BLOCK_SIZE); // Múltiplo de LANE_WIDTH
+
+    for (int k = kStart; k < kEnd; ++k) {
+        const int* rowK = &distances[static_cast<size_t>(k) * stride];
+
+        for (int i = iStart; i < iEnd; ++i) {
+            int* rowI = &distances[static_cast<size_t>(i) * stride];
+            const int distIK = rowI[k];
+            if (distIK >= INFINITE_DISTANCE) continue;
+
+            int j = jStart;
+#if defined(__AVX2__)
+            const __m256i viaK = _mm256_set1_epi32(distIK);
+            for (; j < jEnd; j += 8) {
+                __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rowI + j));
+                __m256i candidate = _mm256_add_epi32(
+                    viaK, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rowK + j)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(rowI + j),
+                                    _mm256_min_epi32(current, candidate));
+            }
+#elif defined(__SSE2__)
+            const __m128i viaK = _mm_set1_epi32(distIK);
+            for (; j < jEnd; j += 4) {
+                __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowI + j));
+                __m128i candidate = _mm_add_epi32(
+                    viaK, _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowK + j)));
+                __m128i better = _mm_cmpgt_epi32(current, candidate);
+                // SSE2 no tiene mínimo de enteros de 32 bits
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(rowI + j),
+                                 _mm_or_si128(_mm_and_si128(better, candidate),
+                                              _mm_andnot_si128(better, current)));
+            }
+#endif
+            for (; j < jEnd; ++j) {
+                rowI[j] = std::min(rowI[j], distIK + rowK[j]);
+            }
+        }
+    }
+}
+
+int DenseSolver::getDistance(int from, int to) const {
+    int distance = distances[static_cast<size_t>(from) * stride + to];
+    return distance >= INFINITE_DISTANCE ? -1 : distance; // -1 indica que no hay camino
+}
+
+int DenseSolver::size() const {
+    return numNodes;
+}
+
+std::vector<int> DenseSolver::getParents(int source, const IndexedGraph& graph) const {
+    const int* row = &distances[static_cast<size_t>(source) * stride];
+    std::vector<int> parents(numNodes, -1);
+
+    // Se recorren los u en orden de índice, así que a igual d(u) se queda el
+    // primero que llegó
+    for (int u = 0; u < numNodes; ++u) {
+        if (row[u] >= INFINITE_DISTANCE) continue;
+        for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; ++e) {
+            const int v = graph.targets[e];
+            if (v == source || row[u] + graph.weights[e] != row[v]) continue;
+            if (parents[v] < 0 || row[u] < row[parents[v]]) {
+                parents[v] = u;
+            }
+        }
+    }
+    return parents;
+}
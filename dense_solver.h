@@ -0,0 +1,52 @@
+#ifndef DENSE_SOLVER_H
+#define DENSE_SOLVER_H
+
+#include "shortest_path.h"
+#include <vector>
+#include <limits>
+
+/**
+ * Clase DenseSolver - Caminos mínimos entre todos los pares sobre una
+ * matriz de distancias densa (Floyd-Warshall por bloques)
+ *
+ * Los nodos se identifican por índice [0, n). Las filas se rellenan hasta un
+ * múltiplo de 8 columnas para que el núcleo pueda usar AVX2/SSE2 sin casos
+ * especiales. El núcleo solo calcula distancias; los caminos salen de
+ * getParents() con el mismo desempate que Dijkstra.
+ */
+class DenseSolver {
+private:
+    static const int BLOCK_SIZE = 64;      // Lado del bloque (múltiplo de 8)
+    static const int LANE_WIDTH = 8;       // Enteros por registro AVX2
+
+    int numNodes;
+    int stride;                    // Columnas por fila, con relleno
+    std::vector<int> distances;    // distances[i * stride + j]
+
+    void relaxBlock(int iBlock, int jBlock, int kBlock);
+
+public:
+    // Distancia que representa "sin camino"; su doble no desborda un int
+    static const int INFINITE_DISTANCE = std::numeric_limits<int>::max() / 2;
+
+    // Constructor
+    explicit DenseSolver(int nodes);
+
+    // Carga de enlaces (bidireccionales se agregan dos veces). Todo camino
+    // debe costar menos que INFINITE_DISTANCE; Network usa Dijkstra si no
+    void setEdge(int from, int to, int cost);
+
+    // Ejecuta Floyd-Warshall por bloques
+    void solve();
+
+    // Consultas sobre el resultado
+    int getDistance(int from, int to) const;
+    int size() const;
+
+    // Predecesor de cada nodo en los caminos desde source (-1 si no hay).
+    // Entre los u con d(u) + w(u, v) = d(v) gana el de menor (d(u), índice),
+    // el mismo que elige Dijkstra. graph tiene los enlaces cargados con setEdge
+    std::vector<int> getParents(int source, const IndexedGraph& graph) const;
+};
+
+#endif // DENSE_SOLVER_H
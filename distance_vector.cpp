@@ -0,0 +1,219 @@
+#include "distance_vector.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+const int DistanceVectorSimulator::INFINITE_DISTANCE = std::numeric_limits<int>::max();
+const int DistanceVectorSimulator::CHUNK_SIZE;
+
+DistanceVectorSimulator::DistanceVectorSimulator(const Network& net, int numThreads)
+    : network(net), generation(0), pendingWorkers(0), stopping(false),
+      nextNode(0), messageCount(0), changedNodes(0), currentRound(0) {
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (numThreads <= 0) numThreads = 1;
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        workers.push_back(std::thread(&DistanceVectorSimulator::workerLoop, this));
+    }
+}
+
+DistanceVectorSimulator::~DistanceVectorSimulator() {
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        stopping = true;
+    }
+    roundStart.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void DistanceVectorSimulator::buildNodes() {
+    nodes.clear();
+    indices.clear();
+
+    std::vector<std::string> names = network.getRouterNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+        indices[names[i]] = static_cast<int>(i);
+    }
+
+    for (const std::string& name : names) {
+        std::unique_ptr<Node> node(new Node());
+        node->name = name;
+
+        for (const auto& link : network.getLinks(name)) {
+            node->neighbors.push_back(std::make_pair(indices[link.first], link.second));
+        }
+        // Los vecinos quedan ordenados por índice porque el mapa está ordenado
+        node->neighborVectors.resize(node->neighbors.size());
+        node->distances.assign(names.size(), INFINITE_DISTANCE);
+        node->nextHop.assign(names.size(), -1);
+        nodes.push_back(std::move(node));
+    }
+}
+
+DistanceVectorStats DistanceVectorSimulator::run() {
+    DistanceVectorStats stats;
+    buildNodes();
+    messageCount = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Ronda 0: cada enrutador anuncia sus enlaces directos
+    currentRound = 0;
+    runRound();
+    while (changedNodes > 0) {
+        ++currentRound;
+        runRound();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    stats.rounds = currentRound + 1;
+    stats.messages = messageCount;
+    stats.elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+    stats.mismatches = countMismatches();
+    return stats;
+}
+
+void DistanceVectorSimulator::runRound() {
+    {
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        nextNode = 0;
+        changedNodes = 0;
+        pendingWorkers = static_cast<int>(workers.size());
+        ++generation;
+    }
+    roundStart.notify_all();
+
+    std::unique_lock<std::mutex> lock(schedulerMutex);
+    roundDone.wait(lock, [this] { return pendingWorkers == 0; });
+}
+
+void DistanceVectorSimulator::workerLoop() {
+    unsigned long seenGeneration = 0;
+
+    while (true) {
+        int round;
+        {
+            std::unique_lock<std::mutex> lock(schedulerMutex);
+            roundStart.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+            round = currentRound;
+        }
+
+        // Tomar enrutadores en bloques hasta agotar la ronda
+        const int numNodes = static_cast<int>(nodes.size());
+        int first;
+        while ((first = nextNode.fetch_add(CHUNK_SIZE)) < numNodes) {
+            int last = std::min(numNodes, first + CHUNK_SIZE);
+            for (int i = first; i < last; ++i) {
+                processNode(*nodes[i], round);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        if (--pendingWorkers == 0) {
+            roundDone.notify_one();
+        }
+    }
+}
+
+void DistanceVectorSimulator::processNode(Node& node, int round) {
+    // Nadie escribe en la cola de esta ronda mientras se procesa
+    std::vector<Message>& inbox = node.inbox[round % 2];
+    if (round > 0 && inbox.empty()) {
+        return;
+    }
+
+    for (const Message& message : inbox) {
+        auto slot = std::lower_bound(node.neighbors.begin(), node.neighbors.end(),
+                                     std::make_pair(message.from, 0));
+        node.neighborVectors[slot - node.neighbors.begin()] = message.distances;
+    }
+    inbox.clear();
+
+    // Bellman-Ford local: D(x, y) = min sobre vecinos v de c(x, v) + D(v, y)
+    const size_t numNodes = node.distances.size();
+    std::vector<int> distances(numNodes, INFINITE_DISTANCE);
+    std::vector<int> nextHop(numNodes, -1);
+    int self = indices.at(node.name);
+    distances[self] = 0;
+    nextHop[self] = self;
+
+    for (size_t n = 0; n < node.neighbors.size(); ++n) {
+        int neighbor = node.neighbors[n].first;
+        int linkCost = node.neighbors[n].second;
+
+        if (linkCost < distances[neighbor]) {
+            distances[neighbor] = linkCost;
+            nextHop[neighbor] = neighbor;
+        }
+
+        const VectorSnapshot& advertised = node.neighborVectors[n];
+        if (!advertised) continue;
+        for (size_t y = 0; y < numNodes; ++y) {
+            if ((*advertised)[y] >= INFINITE_DISTANCE) continue;
+            // Suma en 64 bits: un costo de enlace cualquiera no desborda
+            long long candidate = std::min<long long>(
+                INFINITE_DISTANCE, static_cast<long long>(linkCost) + (*advertised)[y]);
+            if (candidate < distances[y]) {
+                distances[y] = static_cast<int>(candidate);
+                nextHop[y] = neighbor;
+            }
+        }
+    }
+
+    node.nextHop.swap(nextHop);
+    if (distances == node.distances) {
+        return;
+    }
+    node.distances.swap(distances);
+
+    // Enviar el nuevo vector a todos los vecinos para la siguiente ronda
+    VectorSnapshot snapshot = std::make_shared<const std::vector<int>>(node.distances);
+    for (const auto& neighbor : node.neighbors) {
+        Node& target = *nodes[neighbor.first];
+        std::lock_guard<std::mutex> lock(target.inboxMutex);
+        target.inbox[(round + 1) % 2].push_back(Message{self, snapshot});
+    }
+    messageCount += static_cast<long long>(node.neighbors.size());
+    ++changedNodes;
+}
+
+int DistanceVectorSimulator::countMismatches() const {
+    int mismatches = 0;
+    for (const auto& source : nodes) {
+        for (const auto& destination : indices) {
+            int expected = network.getPacketCost(source->name, destination.first);
+            if (getCost(source->name, destination.first) != expected) {
+                ++mismatches;
+            }
+        }
+    }
+    return mismatches;
+}
+
+int DistanceVectorSimulator::getCost(const std::string& source,
+                                     const std::string& destination) const {
+    auto from = indices.find(source);
+    auto to = indices.find(destination);
+    if (from == indices.end() || to == indices.end()) {
+        return -1;
+    }
+    int distance = nodes[from->second]->distances[to->second];
+    return distance >= INFINITE_DISTANCE ? -1 : distance; // -1 indica que no hay ruta
+}
+
+std::string DistanceVectorSimulator::getNextHop(const std::string& source,
+                                                const std::string& destination) const {
+    auto from = indices.find(source);
+    auto to = indices.find(destination);
+    if (from == indices.end() || to == indices.end()) {
+        return std::string();
+    }
+    int hop = nodes[from->second]->nextHop[to->second];
+    return hop < 0 ? std::string() : nodes[hop]->name;
+}
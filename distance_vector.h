@@ -0,0 +1,93 @@
+#ifndef DISTANCE_VECTOR_H
+#define DISTANCE_VECTOR_H
+
+#include "network.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Estructura con los resultados de una simulación vector-distancia
+ */
+struct DistanceVectorStats {
+    int rounds;             // Rondas hasta la convergencia
+    long long messages;     // Vectores enviados entre vecinos
+    double elapsedMs;       // Tiempo de convergencia (milisegundos)
+    int mismatches;         // Entradas que difieren de las tablas de Dijkstra
+
+    DistanceVectorStats() : rounds(0), messages(0), elapsedMs(0.0), mismatches(0) {}
+};
+
+/**
+ * Clase DistanceVectorSimulator - Simula un protocolo vector-distancia
+ * (Bellman-Ford distribuido) sobre la topología de una Network
+ *
+ * Cada enrutador tiene una cola de mensajes; en cada ronda procesa los
+ * vectores recibidos, recalcula el suyo y, si cambió, lo envía a sus vecinos.
+ * Los mensajes de una ronda se entregan juntos al inicio de la siguiente.
+ * Las rondas se reparten entre un grupo fijo de hilos.
+ */
+class DistanceVectorSimulator {
+private:
+    typedef std::shared_ptr<const std::vector<int>> VectorSnapshot;
+
+    struct Message {
+        int from;
+        VectorSnapshot distances;
+    };
+
+    struct Node {
+        std::string name;
+        std::vector<std::pair<int, int>> neighbors;   // (índice, costo)
+        std::vector<VectorSnapshot> neighborVectors;  // Último vector de cada vecino
+        std::vector<int> distances;
+        std::vector<int> nextHop;
+        std::vector<Message> inbox[2];                // Doble búfer por ronda
+        std::mutex inboxMutex;
+    };
+
+    static const int INFINITE_DISTANCE;
+    static const int CHUNK_SIZE = 64;   // Enrutadores tomados por hilo a la vez
+
+    const Network& network;
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::map<std::string, int> indices;        // Nombre -> índice en nodes
+
+    // Planificador: hilos persistentes sincronizados por ronda
+    std::vector<std::thread> workers;
+    std::mutex schedulerMutex;
+    std::condition_variable roundStart;
+    std::condition_variable roundDone;
+    unsigned long generation;
+    int pendingWorkers;
+    bool stopping;
+    std::atomic<int> nextNode;
+    std::atomic<long long> messageCount;
+    std::atomic<int> changedNodes;
+    int currentRound;
+
+    void buildNodes();
+    void workerLoop();
+    void runRound();
+    void processNode(Node& node, int round);
+    int countMismatches() const;
+
+public:
+    // Constructor y destructor
+    explicit DistanceVectorSimulator(const Network& net, int numThreads = 0);
+    ~DistanceVectorSimulator();
+
+    // Ejecuta el protocolo hasta que ningún enrutador cambie su vector
+    DistanceVectorStats run();
+
+    // Consultas sobre el estado convergido
+    int getCost(const std::string& source, const std::string& destination) const;
+    std::string getNextHop(const std::string& source, const std::string& destination) const;
+};
+
+#endif // DISTANCE_VECTOR_H
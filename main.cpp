@@ -1,7 +1,10 @@
 #include "network.h"
+#include "distance_vector.h"
 #include <iostream>
 #include <string>
 #include <limits>
+#include <memory>
+#include <thread>
 
 void showMenu() {
     std::cout << "\n╔════════════════════════════════════════════════╗" << std::endl;
@@ -20,6 +23,15 @@ void showMenu() {
     std::cout << "║ 11. Guardar red en archivo                     ║" << std::endl;
     std::cout << "║ 12. Generar red aleatoria                      ║" << std::endl;
     std::cout << "║ 13. Cargar ejemplo del PDF                     ║" << std::endl;
+    std::cout << "║ 14. Simular falla de enlace (respaldo LFA)     ║" << std::endl;
+    std::cout << "║ 15. Simular protocolo vector-distancia         ║" << std::endl;
+    std::cout << "║ 16. Exportar tablas de enrutamiento            ║" << std::endl;
+    std::cout << "║ 17. Cambiar modo de tablas                     ║" << std::endl;
+    std::cout << "║ 18. Configurar latencia/ancho de banda         ║" << std::endl;
+    std::cout << "║ 19. Consultar camino con varias metricas       ║" << std::endl;
+    std::cout << "║ 20. Particionar red en areas                   ║" << std::endl;
+    std::cout << "║ 21. Consultar k caminos mas cortos             ║" << std::endl;
+    std::cout << "║ 22. Evaluar enlace en escenario (sin aplicar)  ║" << std::endl;
     std::cout << "║  0. Salir                                      ║" << std::endl;
     std::cout << "╚════════════════════════════════════════════════╝" << std::endl;
     std::cout << "Seleccione una opción: ";
@@ -30,6 +42,17 @@ void clearInputBuffer() {
     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
 
+// Limita los hilos pedidos a los núcleos del equipo (0 sigue siendo automático)
+int clampThreadCount(int numThreads) {
+    int available = static_cast<int>(std::thread::hardware_concurrency());
+    if (available > 0 && numThreads > available) {
+        std::cout << "Se usaran " << available << " hilos (los disponibles en el equipo)."
+                  << std::endl;
+        return available;
+    }
+    return numThreads;
+}
+
 void loadExampleNetwork(Network& network) {
     std::cout << "\nCargando ejemplo del PDF (Figura 1)..." << std::endl;
 
@@ -216,6 +239,203 @@ int main() {
             break;
         }
 
+        case 14: { // Simular falla de enlace
+            std::string r1, r2;
+            std::cout << "Ingrese el nombre del primer enrutador: ";
+            std::getline(std::cin, r1);
+            std::cout << "Ingrese el nombre del segundo enrutador: ";
+            std::getline(std::cin, r2);
+            network.failLink(r1, r2);
+            break;
+        }
+
+        case 15: { // Simular protocolo vector-distancia
+            int numThreads;
+            std::cout << "Ingrese el numero de hilos (0 = automatico): ";
+            std::cin >> numThreads;
+            clearInputBuffer();
+
+            DistanceVectorSimulator simulator(network, clampThreadCount(numThreads));
+            DistanceVectorStats stats = simulator.run();
+            std::cout << "\nConvergencia en " << stats.rounds << " rondas" << std::endl;
+            std::cout << "Mensajes enviados: " << stats.messages << std::endl;
+            std::cout << "Tiempo: " << stats.elapsedMs << " ms" << std::endl;
+            if (stats.mismatches == 0) {
+                std::cout << "Las tablas coinciden con las calculadas por Dijkstra." << std::endl;
+            } else {
+                std::cout << "Entradas distintas a Dijkstra: " << stats.mismatches << std::endl;
+            }
+            break;
+        }
+
+        case 16: { // Exportar tablas de enrutamiento
+            std::string filename;
+            int numThreads;
+            std::cout << "Ingrese el nombre del archivo: ";
+            std::getline(std::cin, filename);
+            std::cout << "Ingrese el numero de hilos: ";
+            std::cin >> numThreads;
+            clearInputBuffer();
+            network.exportRoutingTablesToFile(filename, clampThreadCount(numThreads));
+            break;
+        }
+
+        case 17: { // Cambiar modo de tablas
+            int mode;
+            std::cout << "Modo (0 en memoria, 1 streaming, 2 jerarquico por areas): ";
+            std::cin >> mode;
+            clearInputBuffer();
+
+            if (mode == 0) {
+                network.setTableMode(Network::TableMode::RESIDENT);
+                std::cout << "Modo en memoria: tablas de enrutamiento recalculadas." << std::endl;
+            } else if (mode == 1) {
+                network.setTableMode(Network::TableMode::STREAMING);
+                std::cout << "Modo streaming: las rutas se calculan bajo demanda." << std::endl;
+            } else if (mode == 2) {
+                network.setTableMode(Network::TableMode::HIERARCHICAL);
+                std::cout << "Modo jerarquico: tablas por area y red de bordes." << std::endl;
+            } else {
+                std::cout << "Modo no valido." << std::endl;
+            }
+            break;
+        }
+
+        case 18: { // Configurar métricas de enlace
+            std::string r1, r2;
+            int latency, bandwidth;
+            std::cout << "Ingrese el nombre del primer enrutador: ";
+            std::getline(std::cin, r1);
+            std::cout << "Ingrese el nombre del segundo enrutador: ";
+            std::getline(std::cin, r2);
+            std::cout << "Ingrese la latencia del enlace: ";
+            std::cin >> latency;
+            std::cout << "Ingrese el ancho de banda del enlace: ";
+            std::cin >> bandwidth;
+            clearInputBuffer();
+            network.setLinkMetrics(r1, r2, latency, bandwidth);
+            break;
+        }
+
+        case 19: { // Consultar camino con varias métricas
+            std::string source, dest;
+            int objective;
+            PathQuery query;
+            std::cout << "Ingrese el enrutador origen: ";
+            std::getline(std::cin, source);
+            std::cout << "Ingrese el enrutador destino: ";
+            std::getline(std::cin, dest);
+            std::cout << "Objetivo (0 costo, 1 costo+latencia, 2 suma ponderada, 3 mas ancho): ";
+            std::cin >> objective;
+            if (objective == 2) {
+                std::cout << "Ingrese el peso del costo: ";
+                std::cin >> query.costWeight;
+                std::cout << "Ingrese el peso de la latencia: ";
+                std::cin >> query.latencyWeight;
+            }
+            std::cout << "Ingrese el maximo de saltos (0 = sin limite): ";
+            std::cin >> query.maxHops;
+            std::cout << "Ingrese el ancho de banda minimo (0 = sin limite): ";
+            std::cin >> query.minBandwidth;
+            clearInputBuffer();
+
+            if (objective < 0 || objective > 3) {
+                std::cout << "Objetivo no valido." << std::endl;
+                break;
+            }
+            query.objective = static_cast<PathObjective>(objective);
+
+            PathResult result = network.findConstrainedPath(source, dest, query);
+            if (result.found) {
+                std::cout << "\nCamino de " << source << " a " << dest << ":\n";
+                for (size_t i = 0; i < result.path.size(); ++i) {
+                    std::cout << result.path[i];
+                    if (i < result.path.size() - 1) {
+                        std::cout << " -> ";
+                    }
+                }
+                std::cout << "\nCosto: " << result.cost
+                          << "  Latencia: " << result.latency
+                          << "  Ancho de banda: " << result.bottleneck << std::endl;
+            } else {
+                std::cout << "\nNo hay camino que cumpla las restricciones entre " << source
+                          << " y " << dest << std::endl;
+            }
+            break;
+        }
+
+        case 20: { // Particionar red en áreas
+            int numAreas;
+            std::cout << "Ingrese el numero de areas: ";
+            std::cin >> numAreas;
+            clearInputBuffer();
+            network.partitionIntoAreas(numAreas);
+            break;
+        }
+
+        case 21: { // Consultar k caminos más cortos
+            std::string source, dest;
+            int k;
+            std::cout << "Ingrese el enrutador origen: ";
+            std::getline(std::cin, source);
+            std::cout << "Ingrese el enrutador destino: ";
+            std::getline(std::cin, dest);
+            std::cout << "Ingrese el numero de caminos (k): ";
+            std::cin >> k;
+            clearInputBuffer();
+
+            std::vector<PathView> paths = network.getKShortestPaths(source, dest, k);
+            if (paths.empty()) {
+                std::cout << "\nNo hay ruta disponible entre " << source
+                          << " y " << dest << std::endl;
+                break;
+            }
+            for (size_t p = 0; p < paths.size(); ++p) {
+                std::cout << (p + 1) << ". (costo " << paths[p].getCost() << ") ";
+                for (size_t i = 0; i < paths[p].size(); ++i) {
+                    std::cout << paths[p][i];
+                    if (i < paths[p].size() - 1) {
+                        std::cout << " -> ";
+                    }
+                }
+                std::cout << std::endl;
+            }
+            break;
+        }
+
+        case 22: { // Evaluar enlace en una red bifurcada
+            std::string r1, r2;
+            int cost;
+            std::cout << "Ingrese el nombre del primer enrutador: ";
+            std::getline(std::cin, r1);
+            std::cout << "Ingrese el nombre del segundo enrutador: ";
+            std::getline(std::cin, r2);
+            std::cout << "Ingrese el costo del enlace: ";
+            std::cin >> cost;
+            clearInputBuffer();
+
+            // El escenario comparte el estado con la red y solo copia lo que cambia
+            std::unique_ptr<Network> scenario = network.fork();
+            scenario->addLink(r1, r2, cost);
+
+            std::vector<RouteChange> changes = scenario->diffRoutingTables(network);
+            std::cout << "\nRutas que cambiarian: " << changes.size() << std::endl;
+            for (const RouteChange& change : changes) {
+                std::cout << "  " << change.source << " -> " << change.destination
+                          << ": costo " << change.oldCost << " -> " << change.newCost
+                          << "  camino ";
+                for (size_t i = 0; i < change.newPath.size(); ++i) {
+                    std::cout << change.newPath[i];
+                    if (i < change.newPath.size() - 1) {
+                        std::cout << " -> ";
+                    }
+                }
+                std::cout << std::endl;
+            }
+            std::cout << "La red original no fue modificada." << std::endl;
+            break;
+        }
+
         case 0: { // Salir
             std::cout << "\nGracias por usar el simulador de red de enrutadores." << std::endl;
             std::cout << "Hasta pronto!" << std::endl;
@@ -1,43 +1,176 @@
 #include "network.h"
+#include "dense_solver.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <tuple>
 #include <cstdlib>
 #include <ctime>
+#include <functional>
+#include <queue>
+#include <stdexcept>
 
-Network::Network() {
+Network::Network()
+    : tableMode(TableMode::RESIDENT), areasNeedRebuild(true), batchLoading(false),
+      routesNeedRebuild(false) {
     std::srand(static_cast<unsigned>(std::time(nullptr)));
 }
 
 Network::~Network() {
-    for (auto& pair : routers) {
-        delete pair.second;
+    // Los enrutadores se liberan al soltar la última referencia compartida
+}
+
+std::unique_ptr<Network> Network::fork() const {
+    // Solo se copian punteros compartidos; los datos se duplican al escribir
+    return std::unique_ptr<Network>(new Network(*this));
+}
+
+std::vector<RouteChange> Network::diffRoutingTables(const Network& parent) const {
+    std::vector<RouteChange> changes;
+    bool resident = tableMode == TableMode::RESIDENT &&
+                    parent.tableMode == TableMode::RESIDENT;
+    if (resident && routers.sharesWith(parent.routers)) {
+        return changes; // Ningún enrutador cambió
+    }
+
+    const RouterTable& mine = routers.read();
+    const RouterTable& theirs = parent.routers.read();
+    static const std::map<std::string, RoutingEntry> noRoutes;
+
+    std::set<std::string> names;
+    for (const auto& pair : mine) names.insert(pair.first);
+    for (const auto& pair : theirs) names.insert(pair.first);
+
+    for (const std::string& source : names) {
+        auto current = mine.find(source);
+        auto previous = theirs.find(source);
+        bool inMine = current != mine.end();
+        bool inTheirs = previous != theirs.end();
+
+        // Sin tablas residentes se arma una tabla temporal por origen
+        Router newBuilt(source), oldBuilt(source);
+        const Router* newRouter = inMine ? &current->second.read() : nullptr;
+        const Router* oldRouter = inTheirs ? &previous->second.read() : nullptr;
+        if (!resident) {
+            if (inMine) newRouter = &(newBuilt = buildRoutingTable(source));
+            if (inTheirs) oldRouter = &(oldBuilt = parent.buildRoutingTable(source));
+        } else if (inMine && inTheirs && current->second.sharesWith(previous->second)) {
+            continue; // Los enrutadores que siguen compartidos no cambiaron
+        }
+
+        const std::map<std::string, RoutingEntry>& newTable =
+            newRouter ? newRouter->getRoutingTable() : noRoutes;
+        const std::map<std::string, RoutingEntry>& oldTable =
+            oldRouter ? oldRouter->getRoutingTable() : noRoutes;
+
+        std::set<std::string> destinations;
+        for (const auto& entry : newTable) destinations.insert(entry.first);
+        for (const auto& entry : oldTable) destinations.insert(entry.first);
+
+        for (const std::string& destination : destinations) {
+            auto after = newTable.find(destination);
+            auto before = oldTable.find(destination);
+            RouteChange change;
+            change.source = source;
+            change.destination = destination;
+            change.oldCost = before != oldTable.end() ? before->second.cost : -1;
+            change.newCost = after != newTable.end() ? after->second.cost : -1;
+            if (after != newTable.end()) {
+                change.newPath = after->second.path;
+            }
+
+            bool samePath = before != oldTable.end() && after != newTable.end() &&
+                            before->second.path == after->second.path;
+            if (change.oldCost != change.newCost || !samePath) {
+                changes.push_back(change);
+            }
+        }
+    }
+    return changes;
+}
+
+const Network::LinkRow& Network::linksOf(const std::string& name) const {
+    static const LinkRow noLinks;
+    auto it = topology.read().find(name);
+    return it != topology.read().end() ? it->second.read() : noLinks;
+}
+
+Network::LinkRow& Network::mutableLinksOf(const std::string& name) {
+    return topology.write()[name].write();
+}
+
+const Router& Network::routerOf(const std::string& name) const {
+    return routers.read().at(name).read();
+}
+
+Router& Network::mutableRouter(const std::string& name) {
+    return routers.write().at(name).write();
+}
+
+const Network::AttributeRow& Network::attributesOf(const std::string& name) const {
+    static const AttributeRow noAttributes;
+    auto it = linkAttributes.read().find(name);
+    return it != linkAttributes.read().end() ? it->second.read() : noAttributes;
+}
+
+void Network::eraseLinkAttributes(const std::string& router1, const std::string& router2) {
+    // Solo se tocan (y duplican) las filas que tienen métricas del enlace
+    if (attributesOf(router1).count(router2) > 0) {
+        linkAttributes.write()[router1].write().erase(router2);
+    }
+    if (attributesOf(router2).count(router1) > 0) {
+        linkAttributes.write()[router2].write().erase(router1);
     }
-    routers.clear();
+}
+
+void Network::replaceRoutingTable(Router table) {
+    // Si la tabla no cambió se conserva la compartida
+    std::string name = table.getName();
+    if (routerOf(name).hasSameRoutes(table)) {
+        return;
+    }
+    routers.write().at(name) = CowPtr<Router>(std::make_shared<Router>(std::move(table)));
 }
 
 void Network::addRouter(const std::string& name) {
-    if (routers.find(name) == routers.end()) {
-        routers[name] = new Router(name);
-        topology[name] = std::map<std::string, int>();
+    if (!hasRouter(name)) {
+        routers.write().insert(std::make_pair(
+            name, CowPtr<Router>(std::make_shared<Router>(name))));
+        topology.write()[name] = CowPtr<LinkRow>();
         std::cout << "Enrutador '" << name << "' agregado a la red." << std::endl;
+        // Queda sin área; en modo jerárquico su primer enlace lo une al área
+        // del vecino (markLinkAreasDirty)
     } else {
         std::cout << "El enrutador '" << name << "' ya existe en la red." << std::endl;
     }
 }
 
 void Network::removeRouter(const std::string& name) {
-    auto it = routers.find(name);
-    if (it != routers.end()) {
-        delete it->second;
-        routers.erase(it);
-        topology.erase(name);
+    if (hasRouter(name)) {
+        // Eliminar enlaces que conectan a este enrutador (solo en sus vecinos)
+        LinkRow neighbors = linksOf(name);
+        for (const auto& neighbor : neighbors) {
+            mutableLinksOf(neighbor.first).erase(name);
+        }
+        AttributeRow measured = attributesOf(name);
+        for (const auto& neighbor : measured) {
+            eraseLinkAttributes(name, neighbor.first);
+        }
+        if (linkAttributes.read().count(name) > 0) {
+            linkAttributes.write().erase(name);
+        }
 
-        // Eliminar enlaces que conectan a este enrutador
-        for (auto& pair : topology) {
-            pair.second.erase(name);
+        routers.write().erase(name);
+        topology.write().erase(name);
+        if (routerAreas.read().count(name) > 0) {
+            routerAreas.write().erase(name);
         }
+        areasNeedRebuild = true;
 
         std::cout << "Enrutador '" << name << "' eliminado de la red." << std::endl;
         updateAllRoutingTables();
@@ -47,7 +180,7 @@ void Network::removeRouter(const std::string& name) {
 }
 
 bool Network::hasRouter(const std::string& name) const {
-    return routers.find(name) != routers.end();
+    return routers.read().find(name) != routers.read().end();
 }
 
 void Network::addLink(const std::string& router1, const std::string& router2, int cost) {
@@ -61,20 +194,27 @@ void Network::addLink(const std::string& router1, const std::string& router2, in
         return;
     }
 
-    topology[router1][router2] = cost;
-    topology[router2][router1] = cost; // Enlace bidireccional
+    auto existing = linksOf(router1).find(router2);
+    int oldCost = existing != linksOf(router1).end() ? existing->second : -1;
+    mutableLinksOf(router1)[router2] = cost;
+    mutableLinksOf(router2)[router1] = cost; // Enlace bidireccional
 
     std::cout << "Enlace agregado: " << router1 << " <-> " << router2
               << " (costo: " << cost << ")" << std::endl;
 
-    updateAllRoutingTables();
+    markLinkAreasDirty(router1, router2);
+    updateRoutingTablesForLink(router1, router2, oldCost, cost);
 }
 
 void Network::removeLink(const std::string& router1, const std::string& router2) {
-    if (topology[router1].erase(router2) > 0) {
-        topology[router2].erase(router1);
+    if (linksOf(router1).count(router2) > 0) {
+        int oldCost = linksOf(router1).at(router2);
+        mutableLinksOf(router1).erase(router2);
+        mutableLinksOf(router2).erase(router1);
+        eraseLinkAttributes(router1, router2);
         std::cout << "Enlace eliminado: " << router1 << " <-> " << router2 << std::endl;
-        updateAllRoutingTables();
+        markLinkAreasDirty(router1, router2);
+        updateRoutingTablesForLink(router1, router2, oldCost, -1);
     } else {
         std::cout << "No existe enlace entre " << router1 << " y " << router2 << std::endl;
     }
@@ -82,79 +222,964 @@ void Network::removeLink(const std::string& router1, const std::string& router2)
 
 void Network::updateLinkCost(const std::string& router1, const std::string& router2,
                              int newCost) {
-    if (topology[router1].find(router2) != topology[router1].end()) {
-        topology[router1][router2] = newCost;
-        topology[router2][router1] = newCost;
+    if (newCost <= 0) {
+        std::cout << "Error: El costo debe ser positivo." << std::endl;
+        return;
+    }
+
+    if (linksOf(router1).count(router2) > 0) {
+        int oldCost = linksOf(router1).at(router2);
+        mutableLinksOf(router1)[router2] = newCost;
+        mutableLinksOf(router2)[router1] = newCost;
         std::cout << "Costo del enlace actualizado: " << router1 << " <-> " << router2
                   << " (nuevo costo: " << newCost << ")" << std::endl;
-        updateAllRoutingTables();
+        markLinkAreasDirty(router1, router2);
+        updateRoutingTablesForLink(router1, router2, oldCost, newCost);
     } else {
         std::cout << "No existe enlace entre " << router1 << " y " << router2 << std::endl;
     }
 }
 
+void Network::setLinkMetrics(const std::string& router1, const std::string& router2,
+                             int latency, int bandwidth) {
+    if (!hasRouter(router1) || !hasRouter(router2) || linksOf(router1).count(router2) == 0) {
+        std::cout << "No existe enlace entre " << router1 << " y " << router2 << std::endl;
+        return;
+    }
+
+    if (latency < 0 || bandwidth <= 0) {
+        std::cout << "Error: La latencia no puede ser negativa y el ancho de banda debe ser positivo."
+                  << std::endl;
+        return;
+    }
+
+    linkAttributes.write()[router1].write()[router2] = LinkAttributes(latency, bandwidth);
+    linkAttributes.write()[router2].write()[router1] = LinkAttributes(latency, bandwidth);
+    std::cout << "Metricas del enlace actualizadas: " << router1 << " <-> " << router2
+              << " (latencia: " << latency << ", ancho de banda: " << bandwidth << ")" << std::endl;
+}
+
+LinkAttributes Network::getLinkAttributes(const std::string& router1,
+                                          const std::string& router2) const {
+    const AttributeRow& row = attributesOf(router1);
+    auto it = row.find(router2);
+    if (it != row.end()) {
+        return it->second;
+    }
+    // Sin métricas explícitas: latencia igual al costo y ancho de banda ilimitado
+    return LinkAttributes(linksOf(router1).at(router2), std::numeric_limits<int>::max());
+}
+
+void Network::failLink(const std::string& router1, const std::string& router2) {
+    if (!hasRouter(router1) || !hasRouter(router2) || linksOf(router1).count(router2) == 0) {
+        std::cout << "No existe enlace entre " << router1 << " y " << router2 << std::endl;
+        return;
+    }
+    mutableLinksOf(router1).erase(router2);
+    mutableLinksOf(router2).erase(router1);
+    eraseLinkAttributes(router1, router2);
+
+    std::cout << "Falla simulada en el enlace " << router1 << " <-> " << router2 << std::endl;
+
+    // En modo jerárquico basta recalcular el área afectada y la red superpuesta
+    markLinkAreasDirty(router1, router2);
+    if (tableMode == TableMode::HIERARCHICAL) {
+        updateHierarchicalTables();
+        return;
+    }
+
+    // Las tablas conmutadas dejan de ser las de un cálculo completo
+    routesNeedRebuild = true;
+
+    // Revalidar los respaldos de los extremos contra la topología actual
+    // (puede haber otras fallas desde la última actualización)
+    computeBackupRoutes(router1, true);
+    computeBackupRoutes(router2, true);
+
+    // Solo los extremos del enlace conmutan localmente; el resto de tablas
+    // se corrige en la siguiente llamada a updateAllRoutingTables()
+    const std::string ends[2][2] = {{router1, router2}, {router2, router1}};
+    for (const auto& end : ends) {
+        std::vector<std::string> affected;
+        for (const auto& entry : routerOf(end[0]).getRoutingTable()) {
+            if (routerOf(end[0]).getNextHopTo(entry.first) == end[1]) {
+                affected.push_back(entry.first);
+            }
+        }
+
+        for (const std::string& destination : affected) {
+            Router& router = mutableRouter(end[0]);
+            std::string backup = router.getBackupNextHopTo(destination);
+            if (!backup.empty()) {
+                router.activateBackupRoute(destination,
+                                           routerOf(backup).getPathTo(destination));
+                std::cout << "  " << end[0] << " -> " << destination
+                          << ": conmutado al respaldo via " << backup << std::endl;
+            } else {
+                router.removeRoute(destination);
+                std::cout << "  " << end[0] << " -> " << destination
+                          << ": sin respaldo, ruta eliminada" << std::endl;
+            }
+        }
+    }
+
+    // Nuevos respaldos para los extremos con sus rutas ya conmutadas
+    computeBackupRoutes(router1, true);
+    computeBackupRoutes(router2, true);
+}
+
 void Network::updateAllRoutingTables() {
-    // Calcular rutas mÃƒÂ¡s cortas desde cada enrutador usando Dijkstra
-    for (const auto& pair : routers) {
-        dijkstra(pair.first);
+    if (batchLoading) {
+        return; // Se actualiza al terminar la carga
+    }
+
+    // Sin tablas residentes (se vaciaron en setTableMode()): en streaming no
+    // hay nada que mantener y en modo jerárquico solo las tablas de áreas
+    if (tableMode == TableMode::STREAMING) {
+        return;
     }
+    if (tableMode == TableMode::HIERARCHICAL) {
+        updateHierarchicalTables();
+        return;
+    }
+
+    IndexedTopology indexed = indexTopology(topology.read());
+
+    // El motor denso usa int con INFINITE_DISTANCE como "sin camino": solo
+    // sirve si ningún camino posible llega a ese valor
+    long long longestPath = static_cast<long long>(indexed.graph.maxLinkCost) *
+                            std::max(0, indexed.graph.size() - 1);
+
+    if (getLinkDensity() >= DENSE_LINK_DENSITY &&
+        longestPath < DenseSolver::INFINITE_DISTANCE) {
+        // Red densa: una sola pasada de Floyd-Warshall sobre la matriz
+        updateAllRoutingTablesDense(indexed);
+    } else {
+        // Calcular rutas más cortas desde cada enrutador usando Dijkstra
+        std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+        for (int source = 0; source < indexed.graph.size(); ++source) {
+            dijkstra(indexed, *solver, source);
+        }
+    }
+    computeBackupRoutes();
+    routesNeedRebuild = false;
 }
 
-void Network::dijkstra(const std::string& source) {
-    Router* sourceRouter = routers[source];
-    sourceRouter->clearRoutingTable();
+void Network::updateRoutingTablesForLink(const std::string& router1, const std::string& router2,
+                                         int oldCost, int newCost) {
+    if (batchLoading || tableMode != TableMode::RESIDENT || routesNeedRebuild) {
+        updateAllRoutingTables();
+        return;
+    }
 
-    // Estructuras para el algoritmo de Dijkstra
-    std::map<std::string, int> distances;
-    std::map<std::string, std::string> previous;
-    std::set<std::string> unvisited;
+    // Solo se recalculan los orígenes cuyas rutas pueden cambiar; las tablas
+    // residentes son las de un cálculo completo, así que basta mirarlas
+    std::vector<std::string> affected;
+    for (const auto& pair : routers.read()) {
+        const Router& table = pair.second.read();
+        if (isRouteAffected(table, router1, router2, oldCost, newCost) ||
+            isRouteAffected(table, router2, router1, oldCost, newCost)) {
+            affected.push_back(pair.first);
+        }
+    }
+
+    // En una red densa, si cambian muchos orígenes conviene una sola pasada
+    // de Floyd-Warshall
+    if (affected.size() * 4 > routers.read().size() &&
+        getLinkDensity() >= DENSE_LINK_DENSITY) {
+        updateAllRoutingTables();
+        return;
+    }
+
+    if (!affected.empty()) {
+        IndexedTopology indexed = indexTopology(topology.read());
+        std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+        for (const std::string& source : affected) {
+            dijkstra(indexed, *solver, indexed.indices.at(source));
+        }
+    }
+
+    // Los respaldos de un enrutador dependen de su tabla, de sus enlaces y de
+    // las tablas de sus vecinos
+    std::set<std::string> backupSources = {router1, router2};
+    for (const std::string& source : affected) {
+        backupSources.insert(source);
+        for (const auto& neighbor : linksOf(source)) {
+            backupSources.insert(neighbor.first);
+        }
+    }
+    for (const std::string& source : backupSources) {
+        computeBackupRoutes(source, false);
+    }
+}
+
+bool Network::isRouteAffected(const Router& table, const std::string& from,
+                              const std::string& to, int oldCost, int newCost) const {
+    // Cambio del enlace dirigido from -> to (-1 si no existe antes o después)
+    const std::map<std::string, RoutingEntry>& routes = table.getRoutingTable();
+    auto target = routes.find(to);
+
+    // Más caro o eliminado: importa si es el último salto de la ruta hacia to
+    if (oldCost > 0 && (newCost < 0 || newCost > oldCost)) {
+        if (target != routes.end()) {
+            const std::vector<std::string>& path = target->second.path;
+            if (path.size() >= 2 && path[path.size() - 2] == from) {
+                return true;
+            }
+        }
+    }
+
+    // Nuevo o más barato: importa si mejora o empata la ruta hacia to (un
+    // empate puede cambiar el predecesor elegido)
+    if (newCost > 0 && (oldCost < 0 || newCost < oldCost)) {
+        auto origin = routes.find(from);
+        if (origin == routes.end()) {
+            return false; // from no es alcanzable, y por tanto to tampoco
+        }
+        long long candidate = static_cast<long long>(origin->second.cost) + newCost;
+        return target == routes.end() || candidate <= target->second.cost;
+    }
+    return false;
+}
+
+void Network::setTableMode(TableMode mode) {
+    tableMode = mode;
+    areasNeedRebuild = true;
+    if (mode != TableMode::RESIDENT) {
+        // Sin tablas residentes: solo queda la ruta de cada enrutador a sí mismo
+        for (const std::string& name : getRouterNames()) {
+            if (routerOf(name).getRoutingTable().size() > 1) {
+                mutableRouter(name).clearRoutingTable();
+            }
+        }
+    }
+    updateAllRoutingTables();
+}
+
+void Network::partitionIntoAreas(int numAreas) {
+    if (numAreas <= 0) {
+        std::cout << "Error: El numero de areas debe ser positivo." << std::endl;
+        return;
+    }
+
+    assignAreasByRegionGrowing(numAreas);
+    areasNeedRebuild = true;
+    std::cout << "Red particionada en " << std::min<size_t>(numAreas, routers.read().size())
+              << " areas." << std::endl;
+    updateAllRoutingTables();
+}
+
+void Network::setRouterArea(const std::string& name, int area) {
+    if (!hasRouter(name) || area < 0) {
+        std::cout << "Error: Enrutador o area no valida." << std::endl;
+        return;
+    }
+
+    int previous = getRouterArea(name);
+    if (tableMode != TableMode::HIERARCHICAL) {
+        assignRouterArea(name, area);
+        return;
+    }
+
+    // Solo cambian el área anterior (si tenía), la nueva, los bordes de las
+    // áreas vecinas y la red superpuesta
+    routerAreas.write()[name] = area;
+    if (previous >= 0) {
+        dirtyAreas.insert(previous);
+    }
+    dirtyAreas.insert(area);
+    for (const auto& neighbor : linksOf(name)) {
+        if (getRouterArea(neighbor.first) >= 0) {
+            dirtyBorderAreas.insert(getRouterArea(neighbor.first));
+        }
+    }
+    updateHierarchicalTables();
+}
+
+void Network::assignRouterArea(const std::string& name, int area) {
+    // Se aplica en la próxima actualización de tablas (carga por lotes)
+    routerAreas.write()[name] = area;
+    areasNeedRebuild = true;
+}
+
+int Network::getRouterArea(const std::string& name) const {
+    auto it = routerAreas.read().find(name);
+    return it != routerAreas.read().end() ? it->second : -1; // -1 indica sin área
+}
+
+void Network::assignAreasByRegionGrowing(int numAreas) {
+    std::map<std::string, int>& areas = routerAreas.write();
+    areas.clear();
+    if (routers.read().empty()) return;
+
+    // Semillas: cada nueva semilla es el enrutador más lejano (en saltos)
+    // de las anteriores; los no alcanzables se eligen primero
+    std::vector<std::string> seeds;
+    std::map<std::string, int> hops;
+    seeds.push_back(routers.read().begin()->first);
+
+    while (static_cast<int>(seeds.size()) <= numAreas) {
+        hops.clear();
+        std::queue<std::string> frontier;
+        for (const std::string& seed : seeds) {
+            hops[seed] = 0;
+            frontier.push(seed);
+        }
+        while (!frontier.empty()) {
+            std::string current = frontier.front();
+            frontier.pop();
+            for (const auto& neighbor : linksOf(current)) {
+                if (hops.find(neighbor.first) == hops.end()) {
+                    hops[neighbor.first] = hops[current] + 1;
+                    frontier.push(neighbor.first);
+                }
+            }
+        }
+        if (static_cast<int>(seeds.size()) == numAreas) break;
+
+        std::string farthest;
+        int farthestHops = -1;
+        for (const auto& pair : routers.read()) {
+            auto it = hops.find(pair.first);
+            int distance = it == hops.end() ? std::numeric_limits<int>::max() : it->second;
+            if (distance > farthestHops && distance > 0) {
+                farthestHops = distance;
+                farthest = pair.first;
+            }
+        }
+        if (farthest.empty()) break; // Menos enrutadores que áreas
+        seeds.push_back(farthest);
+    }
+
+    // Crecimiento equilibrado: en cada paso suma un enrutador el área más
+    // chica que todavía tiene vecinos libres, así una semilla central no se
+    // queda con casi toda la red
+    typedef std::pair<int, int> Growth;    // (tamaño, área)
+    std::priority_queue<Growth, std::vector<Growth>, std::greater<Growth>> smallest;
+    std::vector<std::queue<std::string>> frontiers(seeds.size());
+    std::vector<int> sizes(seeds.size(), 1);
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        areas[seeds[i]] = static_cast<int>(i);
+        for (const auto& neighbor : linksOf(seeds[i])) {
+            frontiers[i].push(neighbor.first);
+        }
+        smallest.push(Growth(1, static_cast<int>(i)));
+    }
+    while (!smallest.empty()) {
+        int area = smallest.top().second;
+        smallest.pop();
+
+        std::queue<std::string>& frontier = frontiers[area];
+        while (!frontier.empty() && areas.count(frontier.front()) > 0) {
+            frontier.pop(); // Ya lo tomó otra área
+        }
+        if (frontier.empty()) continue; // El área ya no puede crecer
+
+        std::string next = frontier.front();
+        frontier.pop();
+        areas[next] = area;
+        for (const auto& neighbor : linksOf(next)) {
+            if (areas.find(neighbor.first) == areas.end()) {
+                frontier.push(neighbor.first);
+            }
+        }
+        smallest.push(Growth(++sizes[area], area));
+    }
+    for (const auto& pair : routers.read()) {
+        areas.insert(std::make_pair(pair.first, 0)); // Enrutadores aislados
+    }
+}
+
+void Network::markLinkAreasDirty(const std::string& router1, const std::string& router2) {
+    int area1 = getRouterArea(router1);
+    int area2 = getRouterArea(router2);
+    if (tableMode == TableMode::HIERARCHICAL && !areasNeedRebuild && (area1 < 0) != (area2 < 0)) {
+        // Enrutador agregado después de particionar: entra al área del vecino
+        int area = std::max(area1, area2);
+        routerAreas.write()[area1 < 0 ? router1 : router2] = area;
+        dirtyAreas.insert(area);
+    } else if (area1 < 0 || area2 < 0) {
+        areasNeedRebuild = true;
+    } else if (area1 == area2) {
+        dirtyAreas.insert(area1);
+    } else {
+        // Un enlace entre áreas solo afecta a los bordes y a la red superpuesta
+        dirtyBorderAreas.insert(area1);
+        dirtyBorderAreas.insert(area2);
+    }
+}
+
+void Network::updateHierarchicalTables() {
+    bool rebuild = areasNeedRebuild || areaTables.empty();
+    if (rebuild) {
+        if (routerAreas.read().empty()) {
+            int numAreas = std::max(1, static_cast<int>(std::sqrt(routers.read().size())));
+            assignAreasByRegionGrowing(numAreas);
+        }
+
+        // Enrutadores nuevos sin área: área de un vecino, o la 0
+        for (const auto& pair : routers.read()) {
+            if (getRouterArea(pair.first) >= 0) continue;
+            int area = 0;
+            for (const auto& neighbor : linksOf(pair.first)) {
+                if (getRouterArea(neighbor.first) >= 0) {
+                    area = getRouterArea(neighbor.first);
+                    break;
+                }
+            }
+            routerAreas.write()[pair.first] = area;
+        }
+        areaTables.clear();
+        overlay = CowPtr<OverlayTables>();
+    }
+
+    // Miembros de las áreas a recalcular (todas si se reconstruye)
+    std::set<int> changed(dirtyAreas);
+    changed.insert(dirtyBorderAreas.begin(), dirtyBorderAreas.end());
+    std::map<int, std::vector<std::string>> members;
+    for (int area : changed) {
+        members[area];
+    }
+    for (const auto& pair : routerAreas.read()) {
+        if (rebuild || changed.count(pair.second) > 0) {
+            members[pair.second].push_back(pair.first);
+        }
+    }
+
+    for (const auto& area : members) {
+        if (rebuild || dirtyAreas.count(area.first) > 0) {
+            computeAreaTables(area.first, area.second);
+        }
+    }
+    areasNeedRebuild = false;
+    dirtyAreas.clear();
+    dirtyBorderAreas.clear();
+    updateOverlay(members);
+}
+
+void Network::computeAreaTables(int area, const std::vector<std::string>& members) {
+    if (members.empty()) {
+        areaTables.erase(area); // El área quedó vacía
+        return;
+    }
+    std::shared_ptr<AreaTables> tables = std::make_shared<AreaTables>();
+
+    IndexedTopology indexed = indexTopology(topology.read(), members);
+    std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+    for (const std::string& name : indexed.names) {
+        shortestPathTree(indexed, *solver, name, tables->distances[name],
+                         tables->previous[name]);
+    }
+    areaTables[area] = tables;
+}
+
+void Network::updateOverlay(const std::map<int, std::vector<std::string>>& changedAreas) {
+    OverlayTables& tables = overlay.write();
+    typedef std::map<std::pair<std::string, std::string>, int> EdgeSet;
+
+    // Enlaces de la red superpuesta que tocan los bordes de las áreas
+    // cambiadas, antes del cambio (en ambos sentidos)
+    EdgeSet before;
+    std::set<std::string> oldBorders;
+    for (const auto& area : changedAreas) {
+        auto borders = tables.borders.find(area.first);
+        if (borders == tables.borders.end()) continue;
+        for (const std::string& border : borders->second) {
+            oldBorders.insert(border);
+            for (const auto& link : tables.links.at(border).read()) {
+                before[std::make_pair(border, link.first)] = link.second;
+                before[std::make_pair(link.first, border)] = link.second;
+            }
+        }
+    }
+
+    // Los mismos enlaces ahora: bordes (enrutadores con un enlace hacia otra
+    // área) y atajos entre bordes de una misma área con la distancia intra-área
+    EdgeSet after;
+    std::set<std::string> newBorders;
+    for (const auto& area : changedAreas) {
+        std::vector<std::string> borders;
+        for (const std::string& name : area.second) {
+            for (const auto& link : linksOf(name)) {
+                if (getRouterArea(link.first) == area.first) continue;
+                after[std::make_pair(name, link.first)] = link.second;
+                after[std::make_pair(link.first, name)] = link.second;
+                if (borders.empty() || borders.back() != name) {
+                    borders.push_back(name);
+                }
+            }
+        }
+        // Un atajo que ya se logra pasando por otro borde del área no hace
+        // falta: con costos positivos las distancias no cambian y la red
+        // superpuesta queda mucho más rala que un grafo completo por área
+        std::vector<std::vector<int>> shortcut(borders.size());
+        for (size_t i = 0; i < borders.size(); ++i) {
+            for (size_t j = 0; j < borders.size(); ++j) {
+                shortcut[i].push_back(getIntraAreaCost(borders[i], borders[j]));
+            }
+        }
+        for (size_t i = 0; i < borders.size(); ++i) {
+            for (size_t j = 0; j < borders.size(); ++j) {
+                if (i == j || shortcut[i][j] < 0) continue;
+                bool redundant = false;
+                for (size_t k = 0; k < borders.size() && !redundant; ++k) {
+                    redundant = k != i && k != j && shortcut[i][k] >= 0 && shortcut[k][j] >= 0 &&
+                                static_cast<long long>(shortcut[i][k]) + shortcut[k][j] ==
+                                    shortcut[i][j];
+                }
+                if (!redundant) {
+                    after[std::make_pair(borders[i], borders[j])] = shortcut[i][j];
+                }
+            }
+        }
+
+        newBorders.insert(borders.begin(), borders.end());
+        if (borders.empty()) {
+            tables.borders.erase(area.first);
+        } else {
+            tables.borders[area.first] = borders;
+        }
+    }
+
+    // Aplicar solo los enlaces que cambiaron: (origen, destino, antes, después),
+    // con -1 si el enlace no existe
+    std::vector<std::tuple<std::string, std::string, int, int>> changes;
+    for (const auto& edge : before) {
+        auto now = after.find(edge.first);
+        if (now == after.end()) {
+            changes.push_back(std::make_tuple(edge.first.first, edge.first.second,
+                                              edge.second, -1));
+            LinkRow& row = tables.links[edge.first.first].write();
+            row.erase(edge.first.second);
+            if (row.empty()) tables.links.erase(edge.first.first);
+        } else if (now->second != edge.second) {
+            changes.push_back(std::make_tuple(edge.first.first, edge.first.second,
+                                              edge.second, now->second));
+            tables.links[edge.first.first].write()[edge.first.second] = now->second;
+        }
+    }
+    for (const auto& edge : after) {
+        if (before.count(edge.first) == 0) {
+            changes.push_back(std::make_tuple(edge.first.first, edge.first.second,
+                                              -1, edge.second));
+            tables.links[edge.first.first].write()[edge.first.second] = edge.second;
+        }
+    }
+
+    // Los índices de la red superpuesta solo cambian con el conjunto de bordes
+    bool bordersChanged = oldBorders != newBorders;
+    if (changes.empty() && !bordersChanged) return;
+
+    tables.indexed = indexTopology(tables.links);
+    const IndexedTopology& indexed = tables.indexed;
+    if (!bordersChanged) {
+        // Mismos índices: se corrigen solo los árboles afectados por los
+        // enlaces cambiados
+        std::vector<LinkChange> indexedChanges;
+        for (const auto& change : changes) {
+            indexedChanges.push_back(LinkChange{indexed.indices.at(std::get<0>(change)),
+                                                indexed.indices.at(std::get<1>(change)),
+                                                std::get<2>(change), std::get<3>(change)});
+        }
+        for (CowPtr<BorderTree>& tree : tables.trees) {
+            if (isTreeAffected(indexedChanges, tree.read().distances, tree.read().parents)) {
+                BorderTree& rows = tree.write();
+                repairShortestPathTree(indexed.graph, indexedChanges, rows.distances,
+                                       rows.parents);
+            }
+        }
+        return;
+    }
+
+    // Cambió el conjunto de bordes: todos los árboles desde cero
+    const int numBorders = indexed.graph.size();
+    std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+    tables.trees.clear();
+    for (int source = 0; source < numBorders; ++source) {
+        solver->solve(source);
+
+        CowPtr<BorderTree> tree;
+        BorderTree& rows = tree.write();
+        rows.distances.assign(numBorders, -1);
+        rows.parents.assign(numBorders, -1);
+        for (int node = 0; node < numBorders; ++node) {
+            long long cost = solver->getDistance(node);
+            if (cost < 0 || cost > std::numeric_limits<int>::max()) continue;
+            rows.distances[node] = static_cast<int>(cost);
+            rows.parents[node] = solver->getParent(node);
+        }
+        tables.trees.push_back(tree);
+    }
+}
+
+int Network::getIntraAreaCost(const std::string& source,
+                              const std::string& destination) const {
+    auto tables = areaTables.find(getRouterArea(source));
+    if (tables == areaTables.end()) return -1;
+
+    auto row = tables->second->distances.find(source);
+    if (row == tables->second->distances.end()) return -1;
+
+    auto it = row->second.find(destination);
+    return it != row->second.end() ? it->second : -1;
+}
 
-    // InicializaciÃƒÂ³n
-    for (const auto& pair : routers) {
-        distances[pair.first] = std::numeric_limits<int>::max();
-        unvisited.insert(pair.first);
+std::vector<std::string> Network::getIntraAreaPath(const std::string& source,
+                                                   const std::string& destination) const {
+    if (getIntraAreaCost(source, destination) < 0) {
+        return std::vector<std::string>();
+    }
+    const AreaTables& tables = *areaTables.at(getRouterArea(source));
+    return reconstructPath(tables.previous.at(source), source, destination);
+}
+
+bool Network::findHierarchicalRoute(const std::string& source,
+                                    const std::string& destination,
+                                    int& cost, std::string& exitBorder,
+                                    std::string& entryBorder) const {
+    int sourceArea = getRouterArea(source);
+    int destinationArea = getRouterArea(destination);
+    if (sourceArea < 0 || destinationArea < 0) return false;
+
+    long long best = std::numeric_limits<long long>::max();
+    exitBorder.clear();
+    entryBorder.clear();
+
+    // Camino sin salir del área
+    if (sourceArea == destinationArea) {
+        int direct = getIntraAreaCost(source, destination);
+        if (direct >= 0) best = direct;
     }
-    distances[source] = 0;
 
-    // Algoritmo de Dijkstra
-    while (!unvisited.empty()) {
-        // Encontrar el nodo no visitado con menor distancia
-        std::string current;
-        int minDist = std::numeric_limits<int>::max();
-        for (const std::string& node : unvisited) {
-            if (distances[node] < minDist) {
-                minDist = distances[node];
-                current = node;
+    // Origen -> borde de salida -> red superpuesta -> borde de entrada -> destino
+    const OverlayTables& tables = overlay.read();
+    auto exits = tables.borders.find(sourceArea);
+    auto entries = tables.borders.find(destinationArea);
+    if (exits != tables.borders.end() && entries != tables.borders.end()) {
+        // Bordes de entrada con su índice en la red superpuesta y su distancia al destino
+        std::vector<std::tuple<const std::string*, int, int>> entryCosts;
+        for (const std::string& entry : entries->second) {
+            int fromEntry = getIntraAreaCost(entry, destination);
+            if (fromEntry >= 0) {
+                entryCosts.push_back(std::make_tuple(&entry, tables.indexed.indices.at(entry),
+                                                     fromEntry));
             }
         }
 
-        if (minDist == std::numeric_limits<int>::max()) {
-            break; // No hay mÃƒÂ¡s nodos alcanzables
+        for (const std::string& exit : exits->second) {
+            int toExit = getIntraAreaCost(source, exit);
+            if (toExit < 0) continue;
+            const std::vector<int>& fromExit =
+                tables.trees[tables.indexed.indices.at(exit)].read().distances;
+
+            for (const auto& entryCost : entryCosts) {
+                const std::string& entry = *std::get<0>(entryCost);
+                int across = fromExit[std::get<1>(entryCost)];
+                if (across < 0) continue;
+
+                long long total = static_cast<long long>(toExit) + across +
+                                  std::get<2>(entryCost);
+                if (total < best) {
+                    best = total;
+                    exitBorder = exit;
+                    entryBorder = entry;
+                }
+            }
         }
+    }
 
-        unvisited.erase(current);
+    if (best > std::numeric_limits<int>::max()) return false;
+    cost = static_cast<int>(best);
+    return true;
+}
 
-        // Actualizar distancias a vecinos
-        for (const auto& neighbor : topology[current]) {
-            const std::string& neighborName = neighbor.first;
-            int edgeCost = neighbor.second;
+Network::TableMode Network::getTableMode() const {
+    return tableMode;
+}
 
-            if (unvisited.find(neighborName) != unvisited.end()) {
-                int newDist = distances[current] + edgeCost;
-                if (newDist < distances[neighborName]) {
-                    distances[neighborName] = newDist;
-                    previous[neighborName] = current;
+void Network::exportRoutingTables(const RouteSink& sink, int numThreads) const {
+    const IndexedTopology indexed = indexTopology(topology.read());
+    const std::vector<std::string>& names = indexed.names;
+    std::atomic<size_t> nextSource(0);
+    std::mutex sinkMutex;
+
+    // Cada hilo mantiene solo el árbol de caminos mínimos de un origen a la vez
+    auto worker = [&]() {
+        std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+        // Una sola entrada por hilo: su camino se reescribe para cada destino,
+        // así que ninguna tabla completa se arma en memoria
+        RoutingEntry entry;
+        std::vector<int> hops;
+
+        size_t i;
+        while ((i = nextSource++) < names.size()) {
+            solver->solve(static_cast<int>(i));
+
+            // El candado agrupa las entradas de un mismo origen; cada una se
+            // arma a partir del árbol y se entrega de inmediato
+            std::lock_guard<std::mutex> lock(sinkMutex);
+            for (int node = 0; node < indexed.graph.size(); ++node) {
+                long long cost = solver->getDistance(node);
+                if (cost < 0 || cost > std::numeric_limits<int>::max()) continue;
+
+                hops.clear();
+                for (int hop = node; hop >= 0; hop = solver->getParent(hop)) {
+                    hops.push_back(hop);
                 }
+                entry.cost = static_cast<int>(cost);
+                entry.path.resize(hops.size());
+                for (size_t h = 0; h < hops.size(); ++h) {
+                    entry.path[h] = names[hops[hops.size() - 1 - h]];
+                }
+                sink(names[i], names[node], entry);
+            }
+        }
+    };
+
+    if (numThreads <= 1) {
+        worker();
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.push_back(std::thread(worker));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void Network::exportRoutingTablesToFile(const std::string& filename, int numThreads) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cout << "Error: No se pudo crear el archivo '" << filename << "'." << std::endl;
+        return;
+    }
+
+    // Formato por línea: Origen->Destino:Camino;Costo
+    long long routeCount = 0;
+    exportRoutingTables([&](const std::string& source, const std::string& destination,
+                            const RoutingEntry& entry) {
+        file << source << "->" << destination << ":";
+        for (size_t i = 0; i < entry.path.size(); ++i) {
+            file << entry.path[i];
+            if (i < entry.path.size() - 1) {
+                file << "-";
+            }
+        }
+        file << ";" << entry.cost << "\n";
+        ++routeCount;
+    }, numThreads);
+
+    file.close();
+    std::cout << "\nTablas de enrutamiento exportadas a '" << filename << "'" << std::endl;
+    std::cout << "  Rutas: " << routeCount << std::endl;
+}
+
+double Network::getLinkDensity() const {
+    size_t numRouters = routers.read().size();
+    if (numRouters < 2) {
+        return 0.0;
+    }
+
+    size_t linkCount = 0;
+    for (const auto& pair : topology.read()) {
+        linkCount += pair.second.read().size();
+    }
+    // Cada enlace se cuenta dos veces, igual que el número de pares posibles
+    return static_cast<double>(linkCount) / (numRouters * (numRouters - 1));
+}
+
+void Network::updateAllRoutingTablesDense(const IndexedTopology& indexed) {
+    const IndexedGraph& graph = indexed.graph;
+    DenseSolver solver(graph.size());
+    for (int from = 0; from < graph.size(); ++from) {
+        for (int e = graph.offsets[from]; e < graph.offsets[from + 1]; ++e) {
+            solver.setEdge(from, graph.targets[e], graph.weights[e]);
+        }
+    }
+    solver.solve();
+
+    // Los caminos salen de los predecesores, con el mismo desempate que
+    // Dijkstra: ambos motores dan las mismas tablas
+    std::vector<int> hops;
+    for (int source = 0; source < graph.size(); ++source) {
+        std::vector<int> parents = solver.getParents(source, graph);
+        Router table(indexed.names[source]);
+
+        for (int node = 0; node < graph.size(); ++node) {
+            int cost = solver.getDistance(source, node);
+            if (cost < 0) continue;
+
+            hops.clear();
+            for (int current = node; current >= 0; current = parents[current]) {
+                hops.push_back(current);
+            }
+            std::vector<std::string> path;
+            path.reserve(hops.size());
+            for (auto hop = hops.rbegin(); hop != hops.rend(); ++hop) {
+                path.push_back(indexed.names[*hop]);
             }
+            table.addRoute(indexed.names[node], cost, path);
         }
+        replaceRoutingTable(std::move(table));
     }
+}
+
+void Network::computeBackupRoutes() {
+    for (const std::string& source : getRouterNames()) {
+        computeBackupRoutes(source, false);
+    }
+}
+
+void Network::computeBackupRoutes(const std::string& source, bool checkPaths) {
+    // Un vecino N de S es alternativa libre de bucles (LFA) hacia D si
+    // dist(N, D) < dist(N, S) + dist(S, D), es decir, si N no devuelve el
+    // paquete a S. Las distancias ya están en las tablas de cada vecino.
+    std::vector<std::string> destinations;
+    for (const auto& entry : routerOf(source).getRoutingTable()) {
+        if (entry.first != source) {
+            destinations.push_back(entry.first);
+        }
+    }
+
+    // Tras una falla las tablas de los vecinos pueden estar desactualizadas:
+    // su camino no debe pasar por S ni usar enlaces que ya no existen
+    auto usablePath = [&](const std::vector<std::string>& path) {
+        for (size_t i = 0; i < path.size(); ++i) {
+            if (path[i] == source) return false;
+            if (i > 0 && linksOf(path[i - 1]).count(path[i]) == 0) return false;
+        }
+        return !path.empty();
+    };
+
+    for (const std::string& destination : destinations) {
+        const Router& sourceRouter = routerOf(source);
+        std::string primary = sourceRouter.getNextHopTo(destination);
+        long long sourceDist = sourceRouter.getCostTo(destination);
+
+        std::string bestHop;
+        long long bestCost = std::numeric_limits<long long>::max();
+
+        for (const auto& neighbor : linksOf(source)) {
+            if (neighbor.first == primary) continue;
+
+            const Router& neighborRouter = routerOf(neighbor.first);
+            long long neighborDist = neighborRouter.getCostTo(destination);
+            long long neighborToSource = neighborRouter.getCostTo(source);
+            if (neighborDist < 0 || neighborToSource < 0) continue;
+            if (checkPaths && !usablePath(neighborRouter.getPathTo(destination))) continue;
+
+            if (neighborDist < neighborToSource + sourceDist) {
+                long long candidate = neighbor.second + neighborDist;
+                if (candidate < bestCost) {
+                    bestCost = candidate;
+                    bestHop = neighbor.first;
+                }
+            }
+        }
+
+        int backupCost = -1;
+        if (!bestHop.empty() && bestCost <= std::numeric_limits<int>::max()) {
+            backupCost = static_cast<int>(bestCost);
+        } else {
+            bestHop.clear();
+        }
+
+        // Solo se escribe (y se duplica el enrutador compartido) si cambió
+        const RoutingEntry& entry = sourceRouter.getRoutingTable().at(destination);
+        if (entry.backupNextHop != bestHop || entry.backupCost != backupCost) {
+            mutableRouter(source).setBackupRoute(destination, bestHop, backupCost);
+        }
+    }
+}
+
+void Network::dijkstra(const IndexedTopology& indexed, ShortestPathSolver& solver,
+                       int source) {
+    solver.solve(source);
 
     // Construir tabla de enrutamiento con los caminos completos
-    for (const auto& pair : routers) {
-        const std::string& destination = pair.first;
-        if (distances[destination] != std::numeric_limits<int>::max()) {
-            std::vector<std::string> path = reconstructPath(previous, source, destination);
-            sourceRouter->addRoute(destination, distances[destination], path);
+    Router table(indexed.names[source]);
+    for (int node = 0; node < indexed.graph.size(); ++node) {
+        long long cost = solver.getDistance(node);
+        // Las tablas guardan int: un costo mayor no es representable
+        if (cost < 0 || cost > std::numeric_limits<int>::max()) continue;
+
+        std::vector<std::string> path;
+        for (int hop : solver.getPath(node)) {
+            path.push_back(indexed.names[hop]);
+        }
+        table.addRoute(indexed.names[node], static_cast<int>(cost), path);
+    }
+    replaceRoutingTable(std::move(table));
+}
+
+Network::IndexedTopology Network::indexTopology(const LinkTable& graph) const {
+    std::vector<std::string> names;
+    for (const auto& pair : graph) {
+        names.push_back(pair.first);
+    }
+    return indexTopology(graph, names);
+}
+
+Network::IndexedTopology Network::indexTopology(const LinkTable& graph,
+                                                const std::vector<std::string>& names) const {
+    // Índices en el orden de names (ordenados, como en el mapa); los enlaces
+    // hacia enrutadores que no están en la lista se omiten
+    IndexedTopology indexed;
+    indexed.names = names;
+    for (size_t i = 0; i < names.size(); ++i) {
+        indexed.indices[names[i]] = static_cast<int>(i);
+    }
+
+    for (const std::string& name : names) {
+        auto row = graph.find(name);
+        if (row != graph.end()) {
+            for (const auto& link : row->second.read()) {
+                auto target = indexed.indices.find(link.first);
+                if (target == indexed.indices.end()) continue;
+
+                indexed.graph.targets.push_back(target->second);
+                indexed.graph.weights.push_back(link.second);
+                indexed.graph.maxLinkCost = std::max(indexed.graph.maxLinkCost, link.second);
+            }
+        }
+        indexed.graph.offsets.push_back(static_cast<int>(indexed.graph.targets.size()));
+    }
+    return indexed;
+}
+
+void Network::shortestPathTree(const std::string& source,
+                               std::map<std::string, int>& distances,
+                               std::map<std::string, std::string>& previous) const {
+    IndexedTopology indexed = indexTopology(topology.read());
+    std::unique_ptr<ShortestPathSolver> solver = makeShortestPathSolver(indexed.graph);
+    shortestPathTree(indexed, *solver, source, distances, previous);
+}
+
+void Network::shortestPathTree(const IndexedTopology& indexed,
+                               ShortestPathSolver& solver,
+                               const std::string& source,
+                               std::map<std::string, int>& distances,
+                               std::map<std::string, std::string>& previous) const {
+    distances.clear();
+    previous.clear();
+
+    auto it = indexed.indices.find(source);
+    if (it == indexed.indices.end()) {
+        distances[source] = 0; // Origen sin enlaces en este grafo
+        return;
+    }
+
+    solver.solve(it->second);
+    for (int node = 0; node < indexed.graph.size(); ++node) {
+        long long cost = solver.getDistance(node);
+        if (cost < 0 || cost > std::numeric_limits<int>::max()) continue;
+
+        distances[indexed.names[node]] = static_cast<int>(cost);
+        if (solver.getParent(node) >= 0) {
+            previous[indexed.names[node]] = indexed.names[solver.getParent(node)];
         }
     }
 }
@@ -182,22 +1207,382 @@ std::vector<std::string> Network::reconstructPath(
 }
 
 int Network::getPacketCost(const std::string& source, const std::string& destination) const {
-    auto it = routers.find(source);
-    if (it != routers.end()) {
-        return it->second->getCostTo(destination);
+    if (tableMode == TableMode::HIERARCHICAL) {
+        if (source == destination) {
+            return hasRouter(source) ? 0 : -1; // También sin área asignada
+        }
+        int cost;
+        std::string exitBorder, entryBorder;
+        return findHierarchicalRoute(source, destination, cost, exitBorder, entryBorder)
+                   ? cost : -1;
+    }
+
+    if (tableMode == TableMode::STREAMING) {
+        if (!hasRouter(source)) return -1;
+
+        std::map<std::string, int> distances;
+        std::map<std::string, std::string> previous;
+        shortestPathTree(source, distances, previous);
+        auto found = distances.find(destination);
+        return found != distances.end() ? found->second : -1;
+    }
+
+    auto it = routers.read().find(source);
+    if (it != routers.read().end()) {
+        return it->second.read().getCostTo(destination);
     }
     return -1;
 }
 
 std::vector<std::string> Network::getPacketPath(const std::string& source,
                                                 const std::string& destination) const {
-    auto it = routers.find(source);
-    if (it != routers.end()) {
-        return it->second->getPathTo(destination);
+    if (tableMode == TableMode::HIERARCHICAL) {
+        if (source == destination) {
+            return hasRouter(source) ? std::vector<std::string>(1, source)
+                                     : std::vector<std::string>();
+        }
+        int cost;
+        std::string exitBorder, entryBorder;
+        if (!findHierarchicalRoute(source, destination, cost, exitBorder, entryBorder)) {
+            return std::vector<std::string>();
+        }
+        if (exitBorder.empty()) {
+            return getIntraAreaPath(source, destination);
+        }
+
+        // Expandir cada tramo de la red superpuesta: los atajos dentro de un
+        // área se reemplazan por su camino intra-área
+        std::vector<std::string> path = getIntraAreaPath(source, exitBorder);
+        const OverlayTables& tables = overlay.read();
+        const BorderTree& tree = tables.trees[tables.indexed.indices.at(exitBorder)].read();
+        std::vector<std::string> overlayPath;
+        for (int node = tables.indexed.indices.at(entryBorder); node >= 0;
+             node = tree.parents[node]) {
+            overlayPath.push_back(tables.indexed.names[node]);
+        }
+        std::reverse(overlayPath.begin(), overlayPath.end());
+        for (size_t i = 1; i < overlayPath.size(); ++i) {
+            const std::string& from = overlayPath[i - 1];
+            const std::string& to = overlayPath[i];
+            if (getRouterArea(from) == getRouterArea(to)) {
+                std::vector<std::string> segment = getIntraAreaPath(from, to);
+                path.insert(path.end(), segment.begin() + 1, segment.end());
+            } else {
+                path.push_back(to);
+            }
+        }
+        std::vector<std::string> tail = getIntraAreaPath(entryBorder, destination);
+        path.insert(path.end(), tail.begin() + 1, tail.end());
+        return path;
+    }
+
+    if (tableMode == TableMode::STREAMING) {
+        if (!hasRouter(source)) return std::vector<std::string>();
+
+        std::map<std::string, int> distances;
+        std::map<std::string, std::string> previous;
+        shortestPathTree(source, distances, previous);
+        if (distances.find(destination) == distances.end()) {
+            return std::vector<std::string>();
+        }
+        return reconstructPath(previous, source, destination);
+    }
+
+    auto it = routers.read().find(source);
+    if (it != routers.read().end()) {
+        return it->second.read().getPathTo(destination);
     }
     return std::vector<std::string>();
 }
 
+std::string Network::getBackupNextHop(const std::string& source,
+                                      const std::string& destination) const {
+    auto it = routers.read().find(source);
+    if (it != routers.read().end()) {
+        return it->second.read().getBackupNextHopTo(destination);
+    }
+    return std::string();
+}
+
+std::vector<PathView> Network::getKShortestPaths(const std::string& source,
+                                                 const std::string& destination,
+                                                 int k) const {
+    std::vector<PathView> result;
+    const LinkTable& graph = topology.read();
+    auto sourceIt = graph.find(source);
+    auto destinationIt = graph.find(destination);
+    if (k <= 0 || sourceIt == graph.end() || destinationIt == graph.end()) {
+        return result;
+    }
+    // Los nodos se manejan como punteros a las claves de la topología
+    const std::string* sourceNode = &sourceIt->first;
+    const std::string* destinationNode = &destinationIt->first;
+
+    // Distancia de cada enrutador al destino (los enlaces son simétricos),
+    // cota inferior de las búsquedas A*. Se calcula siempre sobre la topología
+    // actual: tras failLink() la tabla residente del destino puede tener
+    // costos de respaldo mayores que la distancia real y dejar de ser cota.
+    std::map<const std::string*, int> heuristic;
+    std::map<std::string, int> distances;
+    std::map<std::string, std::string> previous;
+    shortestPathTree(destination, distances, previous);
+    for (const auto& pair : distances) {
+        heuristic[&graph.find(pair.first)->first] = pair.second;
+    }
+
+    // Algoritmo de Yen con la mejora de Lawler: de cada camino aceptado solo
+    // se generan desvíos a partir de su propio punto de desvío
+    struct Candidate {
+        std::vector<const std::string*> path;
+        long long cost;
+        size_t deviation;
+    };
+    std::vector<Candidate> accepted;
+    std::set<std::tuple<long long, std::vector<const std::string*>, size_t>> candidates;
+    std::set<std::vector<const std::string*>> seen;
+
+    std::vector<const std::string*> path;
+    long long cost;
+    if (!spurSearch(sourceNode, destinationNode, std::set<const std::string*>(),
+                    std::set<std::pair<const std::string*, const std::string*>>(),
+                    heuristic, path, cost)) {
+        return result; // No hay camino
+    }
+    accepted.push_back(Candidate{path, cost, 0});
+    seen.insert(path);
+
+    while (static_cast<int>(accepted.size()) < k) {
+        const Candidate last = accepted.back();
+        long long rootCost = 0;
+        std::set<const std::string*> blockedNodes;
+
+        for (size_t i = 0; i + 1 < last.path.size(); ++i) {
+            const std::string* spur = last.path[i];
+
+            if (i >= last.deviation) {
+                // Bloquear el siguiente enlace de los caminos aceptados con la misma raíz
+                std::set<std::pair<const std::string*, const std::string*>> blockedLinks;
+                for (const Candidate& other : accepted) {
+                    if (other.path.size() > i + 1 &&
+                        std::equal(last.path.begin(), last.path.begin() + i + 1,
+                                   other.path.begin())) {
+                        blockedLinks.insert(std::make_pair(other.path[i], other.path[i + 1]));
+                    }
+                }
+
+                std::vector<const std::string*> spurPath;
+                long long spurCost;
+                if (spurSearch(spur, destinationNode, blockedNodes, blockedLinks,
+                               heuristic, spurPath, spurCost)) {
+                    std::vector<const std::string*> full(last.path.begin(),
+                                                         last.path.begin() + i);
+                    full.insert(full.end(), spurPath.begin(), spurPath.end());
+                    if (seen.insert(full).second) {
+                        candidates.insert(std::make_tuple(rootCost + spurCost, full, i));
+                    }
+                }
+            }
+
+            // La raíz crece: el nodo de desvío ya no puede reutilizarse
+            blockedNodes.insert(spur);
+            rootCost += linksOf(*spur).at(*last.path[i + 1]);
+        }
+
+        if (candidates.empty()) break;
+
+        auto best = candidates.begin();
+        accepted.push_back(Candidate{std::get<1>(*best), std::get<0>(*best), std::get<2>(*best)});
+        candidates.erase(best);
+    }
+
+    for (const Candidate& candidate : accepted) {
+        result.push_back(PathView(candidate.path, static_cast<int>(candidate.cost)));
+    }
+    return result;
+}
+
+bool Network::spurSearch(const std::string* spur, const std::string* destination,
+                         const std::set<const std::string*>& blockedNodes,
+                         const std::set<std::pair<const std::string*, const std::string*>>& blockedLinks,
+                         const std::map<const std::string*, int>& heuristic,
+                         std::vector<const std::string*>& path, long long& cost) const {
+    auto estimate = [&heuristic](const std::string* node) -> long long {
+        auto it = heuristic.find(node);
+        return it != heuristic.end() ? it->second : 0;
+    };
+
+    // A*: cola de prioridad (costo + estimación, nodo)
+    typedef std::pair<long long, const std::string*> QueueItem;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+    std::map<const std::string*, long long> best;
+    std::map<const std::string*, const std::string*> previous;
+
+    best[spur] = 0;
+    queue.push(QueueItem(estimate(spur), spur));
+
+    while (!queue.empty()) {
+        QueueItem top = queue.top();
+        queue.pop();
+        const std::string* current = top.second;
+        long long distance = best[current];
+        if (top.first != distance + estimate(current)) continue; // Entrada obsoleta
+
+        if (current == destination) {
+            path.clear();
+            for (const std::string* node = destination; node != spur; node = previous[node]) {
+                path.push_back(node);
+            }
+            path.push_back(spur);
+            std::reverse(path.begin(), path.end());
+            cost = distance;
+            return true;
+        }
+
+        const LinkTable& graph = topology.read();
+        for (const auto& neighbor : graph.find(*current)->second.read()) {
+            const std::string* next = &graph.find(neighbor.first)->first;
+            if (blockedNodes.count(next) > 0 ||
+                blockedLinks.count(std::make_pair(current, next)) > 0) {
+                continue;
+            }
+
+            long long candidate = distance + neighbor.second;
+            auto known = best.find(next);
+            if (known == best.end() || candidate < known->second) {
+                best[next] = candidate;
+                previous[next] = current;
+                queue.push(QueueItem(candidate + estimate(next), next));
+            }
+        }
+    }
+
+    return false;
+}
+
+PathResult Network::findConstrainedPath(const std::string& source,
+                                        const std::string& destination,
+                                        const PathQuery& query) const {
+    // Con pesos negativos la búsqueda por etiquetas deja de ser óptima
+    if (query.objective == PathObjective::WEIGHTED_SUM &&
+        !(query.costWeight >= 0.0 && query.latencyWeight >= 0.0)) {
+        std::cout << "Error: Los pesos de costo y latencia no pueden ser negativos." << std::endl;
+        return PathResult();
+    }
+
+    if (query.objective != PathObjective::WIDEST) {
+        return labelSettingSearch(source, destination, query);
+    }
+
+    // Camino más ancho en dos pasadas: primero el mejor cuello de botella,
+    // luego el camino de menor costo que solo usa enlaces con ese ancho de banda
+    PathResult widest = labelSettingSearch(source, destination, query);
+    if (!widest.found) {
+        return widest;
+    }
+
+    PathQuery cheapest = query;
+    cheapest.objective = PathObjective::LEXICOGRAPHIC;
+    cheapest.minBandwidth = std::max(query.minBandwidth, widest.bottleneck);
+    return labelSettingSearch(source, destination, cheapest);
+}
+
+PathResult Network::labelSettingSearch(const std::string& source,
+                                       const std::string& destination,
+                                       const PathQuery& query) const {
+    PathResult result;
+    if (!hasRouter(source) || !hasRouter(destination)) {
+        return result;
+    }
+
+    // Cada etiqueta es un camino parcial; parent apunta a la etiqueta anterior
+    struct Label {
+        std::string node;
+        long long cost;
+        long long latency;
+        int bottleneck;
+        int hops;
+        int parent;
+    };
+
+    auto keyOf = [&query](const Label& label) -> std::pair<double, double> {
+        switch (query.objective) {
+        case PathObjective::LEXICOGRAPHIC:
+            return std::make_pair(static_cast<double>(label.cost),
+                                  static_cast<double>(label.latency));
+        case PathObjective::WEIGHTED_SUM:
+            return std::make_pair(query.costWeight * label.cost +
+                                  query.latencyWeight * label.latency, 0.0);
+        case PathObjective::WIDEST:
+            return std::make_pair(-static_cast<double>(label.bottleneck), 0.0);
+        default:
+            return std::make_pair(static_cast<double>(label.cost), 0.0);
+        }
+    };
+
+    typedef std::pair<std::pair<double, double>, int> QueueItem; // (clave, etiqueta)
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+    std::vector<Label> labels;
+
+    // Con límite de saltos un nodo puede fijarse otra vez si se llega con
+    // menos saltos (etiquetas no dominadas en clave y saltos)
+    const bool hopLimited = query.maxHops > 0;
+    std::map<std::string, int> settledHops;
+
+    Label start = {source, 0, 0, std::numeric_limits<int>::max(), 0, -1};
+    labels.push_back(start);
+    queue.push(QueueItem(keyOf(start), 0));
+
+    while (!queue.empty()) {
+        int index = queue.top().second;
+        queue.pop();
+        const Label label = labels[index];
+
+        auto settled = settledHops.find(label.node);
+        if (settled != settledHops.end() && (!hopLimited || label.hops >= settled->second)) {
+            continue;
+        }
+        settledHops[label.node] = label.hops;
+
+        if (label.node == destination) {
+            result.found = true;
+            result.cost = label.cost;
+            result.latency = label.latency;
+            result.bottleneck = label.bottleneck;
+            for (int i = index; i >= 0; i = labels[i].parent) {
+                result.path.push_back(labels[i].node);
+            }
+            std::reverse(result.path.begin(), result.path.end());
+            return result;
+        }
+
+        if (hopLimited && label.hops >= query.maxHops) continue;
+
+        auto links = topology.read().find(label.node);
+        if (links == topology.read().end()) continue;
+
+        for (const auto& neighbor : links->second.read()) {
+            auto done = settledHops.find(neighbor.first);
+            if (done != settledHops.end() && (!hopLimited || label.hops + 1 >= done->second)) {
+                continue;
+            }
+
+            LinkAttributes attributes = getLinkAttributes(label.node, neighbor.first);
+            if (attributes.bandwidth < query.minBandwidth) continue;
+
+            Label next = {neighbor.first,
+                          label.cost + neighbor.second,
+                          label.latency + attributes.latency,
+                          std::min(label.bottleneck, attributes.bandwidth),
+                          label.hops + 1,
+                          index};
+            labels.push_back(next);
+            queue.push(QueueItem(keyOf(next), static_cast<int>(labels.size()) - 1));
+        }
+    }
+
+    return result; // Sin camino que cumpla las restricciones
+}
+
 void Network::loadFromFile(const std::string& filename) {
     std::ifstream file(filename);
     if (!file.is_open()) {
@@ -207,11 +1592,17 @@ void Network::loadFromFile(const std::string& filename) {
     }
 
     // Limpiar red actual
-    for (auto& pair : routers) {
-        delete pair.second;
-    }
-    routers.clear();
-    topology.clear();
+    // (las redes bifurcadas conservan su copia del estado anterior)
+    routers = CowPtr<RouterTable>();
+    topology = CowPtr<LinkTable>();
+    linkAttributes = CowPtr<AttributeTable>();
+    routerAreas = CowPtr<std::map<std::string, int>>();
+    areaTables.clear();
+    overlay = CowPtr<OverlayTables>();
+    dirtyAreas.clear();
+    dirtyBorderAreas.clear();
+    areasNeedRebuild = true;
+    batchLoading = true;
 
     std::string line;
     int lineNumber = 0;
@@ -236,8 +1627,30 @@ void Network::loadFromFile(const std::string& filename) {
                 routerName.erase(0, routerName.find_first_not_of(" \t"));
                 routerName.erase(routerName.find_last_not_of(" \t") + 1);
 
+                // Área opcional: Nombre@Area
+                size_t atPos = routerName.find('@');
+                std::string areaStr;
+                if (atPos != std::string::npos) {
+                    areaStr = routerName.substr(atPos + 1);
+                    routerName = routerName.substr(0, atPos);
+                }
+
                 if (!routerName.empty()) {
                     addRouter(routerName);
+                    if (!areaStr.empty()) {
+                        try {
+                            int area = std::stoi(areaStr);
+                            if (area >= 0) {
+                                assignRouterArea(routerName, area);
+                            } else {
+                                std::cout << "Advertencia línea " << lineNumber
+                                          << ": area inválida: '" << areaStr << "'" << std::endl;
+                            }
+                        } catch (const std::exception& e) {
+                            std::cout << "Advertencia línea " << lineNumber
+                                      << ": area inválida: '" << areaStr << "'" << std::endl;
+                        }
+                    }
                 }
             }
             firstLineProcessed = true;
@@ -270,7 +1683,17 @@ void Network::loadFromFile(const std::string& filename) {
         costStr.erase(costStr.find_last_not_of(" \t") + 1);
 
         try {
-            int cost = std::stoi(costStr);
+            // Campos opcionales después del costo: ;Latencia;AnchoDeBanda
+            std::istringstream fields(costStr);
+            std::string field;
+            std::vector<int> values;
+            while (std::getline(fields, field, ';')) {
+                values.push_back(std::stoi(field));
+            }
+            if (values.empty()) {
+                throw std::invalid_argument(costStr);
+            }
+            int cost = values[0];
 
             if (!hasRouter(router1)) {
                 std::cout << "Advertencia lÃ­nea " << lineNumber
@@ -284,6 +1707,16 @@ void Network::loadFromFile(const std::string& filename) {
             }
 
             addLink(router1, router2, cost);
+            if (values.size() > 3) {
+                std::cout << "Advertencia línea " << lineNumber
+                          << ": campos extra ignorados: '" << costStr << "'" << std::endl;
+            }
+            if (values.size() >= 3) {
+                setLinkMetrics(router1, router2, values[1], values[2]);
+            } else if (values.size() == 2) {
+                // Solo latencia: ancho de banda sin límite
+                setLinkMetrics(router1, router2, values[1], std::numeric_limits<int>::max());
+            }
         } catch (const std::exception& e) {
             std::cout << "Advertencia lÃ­nea " << lineNumber
                       << ": costo invÃ¡lido: '" << costStr << "'" << std::endl;
@@ -291,12 +1724,17 @@ void Network::loadFromFile(const std::string& filename) {
     }
 
     file.close();
+
+    // Una sola actualización con la topología completa (en modo jerárquico
+    // las áreas automáticas se reparten sobre todos los enlaces)
+    batchLoading = false;
+    updateAllRoutingTables();
     std::cout << "\nâœ“ Red cargada exitosamente desde '" << filename << "'" << std::endl;
-    std::cout << "  Routers: " << routers.size() << std::endl;
+    std::cout << "  Routers: " << routers.read().size() << std::endl;
 
     int linkCount = 0;
-    for (const auto& pair : topology) {
-        linkCount += pair.second.size();
+    for (const auto& pair : topology.read()) {
+        linkCount += pair.second.read().size();
     }
     linkCount /= 2;
     std::cout << "  Enlaces: " << linkCount << std::endl;
@@ -305,11 +1743,17 @@ void Network::loadFromFile(const std::string& filename) {
 void Network::generateRandom(int numRouters, double linkProbability,
                              int minCost, int maxCost) {
     // Limpiar red actual
-    for (auto& pair : routers) {
-        delete pair.second;
-    }
-    routers.clear();
-    topology.clear();
+    // (las redes bifurcadas conservan su copia del estado anterior)
+    routers = CowPtr<RouterTable>();
+    topology = CowPtr<LinkTable>();
+    linkAttributes = CowPtr<AttributeTable>();
+    routerAreas = CowPtr<std::map<std::string, int>>();
+    areaTables.clear();
+    overlay = CowPtr<OverlayTables>();
+    dirtyAreas.clear();
+    dirtyBorderAreas.clear();
+    areasNeedRebuild = true;
+    batchLoading = true;
 
     // Crear enrutadores
     for (int i = 0; i < numRouters; ++i) {
@@ -329,6 +1773,9 @@ void Network::generateRandom(int numRouters, double linkProbability,
         }
     }
 
+    batchLoading = false;
+    updateAllRoutingTables();
+
     std::cout << "Red aleatoria generada con " << numRouters << " enrutadores." << std::endl;
 }
 
@@ -343,6 +1790,9 @@ void Network::saveToFile(const std::string& filename) const {
     std::vector<std::string> routerNames = getRouterNames();
     for (size_t i = 0; i < routerNames.size(); ++i) {
         file << routerNames[i];
+        if (getRouterArea(routerNames[i]) >= 0) {
+            file << "@" << getRouterArea(routerNames[i]);
+        }
         if (i < routerNames.size() - 1) {
             file << ",";
         }
@@ -352,9 +1802,9 @@ void Network::saveToFile(const std::string& filename) const {
     // LÃ­neas siguientes: enlaces en formato Router1->Router2:Path;Cost
     std::set<std::pair<std::string, std::string>> written;
 
-    for (const auto& pair : topology) {
+    for (const auto& pair : topology.read()) {
         const std::string& router1 = pair.first;
-        for (const auto& link : pair.second) {
+        for (const auto& link : pair.second.read()) {
             const std::string& router2 = link.first;
             int cost = link.second;
 
@@ -362,8 +1812,16 @@ void Network::saveToFile(const std::string& filename) const {
             if (written.find({router1, router2}) == written.end() &&
                 written.find({router2, router1}) == written.end()) {
 
-                // Obtener el path desde router1 a router2
-                std::vector<std::string> path = getPacketPath(router1, router2);
+                // Obtener el path desde router1 a router2; sin tablas
+                // residentes se escribe el propio enlace, para no calcular un
+                // árbol de caminos mínimos por enlace
+                std::vector<std::string> path;
+                if (tableMode == TableMode::STREAMING) {
+                    path.push_back(router1);
+                    path.push_back(router2);
+                } else {
+                    path = getPacketPath(router1, router2);
+                }
 
                 // Construir el path string
                 std::string pathStr;
@@ -374,8 +1832,14 @@ void Network::saveToFile(const std::string& filename) const {
                     }
                 }
 
-                // Escribir en formato: Router1->Router2:Path;Cost
-                file << router1 << "->" << router2 << ":" << pathStr << ";" << cost << "\n";
+                // Escribir en formato: Router1->Router2:Path;Cost[;Latency;Bandwidth]
+                file << router1 << "->" << router2 << ":" << pathStr << ";" << cost;
+                const AttributeRow& row = attributesOf(router1);
+                if (row.count(router2) > 0) {
+                    const LinkAttributes& attributes = row.at(router2);
+                    file << ";" << attributes.latency << ";" << attributes.bandwidth;
+                }
+                file << "\n";
                 written.insert({router1, router2});
             }
         }
@@ -387,11 +1851,11 @@ void Network::saveToFile(const std::string& filename) const {
 }
 void Network::printNetwork() const {
     std::cout << "\n========== TOPOLOGÃƒÂA DE LA RED ==========" << std::endl;
-    std::cout << "Enrutadores: " << routers.size() << std::endl;
+    std::cout << "Enrutadores: " << routers.read().size() << std::endl;
 
     int linkCount = 0;
-    for (const auto& pair : topology) {
-        linkCount += pair.second.size();
+    for (const auto& pair : topology.read()) {
+        linkCount += pair.second.read().size();
     }
     linkCount /= 2; // Cada enlace se cuenta dos veces
 
@@ -399,9 +1863,9 @@ void Network::printNetwork() const {
     std::cout << "\nConexiones:" << std::endl;
 
     std::set<std::pair<std::string, std::string>> printed;
-    for (const auto& pair : topology) {
+    for (const auto& pair : topology.read()) {
         const std::string& router1 = pair.first;
-        for (const auto& link : pair.second) {
+        for (const auto& link : pair.second.read()) {
             const std::string& router2 = link.first;
             int cost = link.second;
 
@@ -416,24 +1880,55 @@ void Network::printNetwork() const {
     std::cout << "=========================================" << std::endl;
 }
 
-void Network::printAllRoutingTables() const {
-    for (const auto& pair : routers) {
-        pair.second->printRoutingTable();
+Router Network::buildRoutingTable(const std::string& source) const {
+    if (tableMode == TableMode::RESIDENT) {
+        return routerOf(source);
+    }
+
+    Router table(source);
+    if (tableMode == TableMode::STREAMING) {
+        std::map<std::string, int> distances;
+        std::map<std::string, std::string> previous;
+        shortestPathTree(source, distances, previous);
+        for (const auto& route : distances) {
+            table.addRoute(route.first, route.second,
+                           reconstructPath(previous, source, route.first));
+        }
+        return table;
     }
+
+    // Jerárquico: combinar tablas de área y red superpuesta
+    for (const auto& destination : routers.read()) {
+        int cost = getPacketCost(source, destination.first);
+        if (cost >= 0) {
+            table.addRoute(destination.first, cost, getPacketPath(source, destination.first));
+        }
+    }
+    return table;
 }
 
-std::vector<std::string> Network::getRouterNames() const {
-    std::vector<std::string> names;
-    for (const auto& pair : routers) {
-        names.push_back(pair.first);
+void Network::printAllRoutingTables() const {
+    if (tableMode != TableMode::RESIDENT) {
+        // Construir e imprimir una tabla temporal por origen
+        for (const auto& pair : routers.read()) {
+            buildRoutingTable(pair.first).printRoutingTable();
+        }
+        return;
+    }
+
+    for (const auto& pair : routers.read()) {
+        pair.second.read().printRoutingTable();
     }
-    return names;
 }
 
 std::vector<std::string> Network::getRouterNames() const {
     std::vector<std::string> names;
-    for (const auto& pair : routers) {
+    for (const auto& pair : routers.read()) {
         names.push_back(pair.first);
     }
     return names;
 }
+
+const std::map<std::string, int>& Network::getLinks(const std::string& name) const {
+    return linksOf(name);
+}
@@ -2,36 +2,266 @@
 #define NETWORK_H
 
 #include "router.h"
+#include "cow_ptr.h"
+#include "shortest_path.h"
+#include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 #include <limits>
 
+/**
+ * Métricas adicionales de un enlace (el costo sigue en la topología)
+ */
+struct LinkAttributes {
+    int latency;    // Latencia del enlace
+    int bandwidth;  // Ancho de banda del enlace
+
+    LinkAttributes() : latency(0), bandwidth(std::numeric_limits<int>::max()) {}
+    LinkAttributes(int lat, int bw) : latency(lat), bandwidth(bw) {}
+};
+
+/**
+ * Objetivo a optimizar en una consulta de camino con varias métricas
+ */
+enum class PathObjective {
+    COST,           // Mínimo costo
+    LEXICOGRAPHIC,  // Mínimo costo; a igual costo, mínima latencia
+    WEIGHTED_SUM,   // Mínimo costWeight * costo + latencyWeight * latencia
+    WIDEST          // Máximo ancho de banda de cuello de botella; luego mínimo costo
+};
+
+/**
+ * Consulta de camino: objetivo más restricciones opcionales
+ */
+struct PathQuery {
+    PathObjective objective;
+    double costWeight;      // Solo para WEIGHTED_SUM
+    double latencyWeight;   // Solo para WEIGHTED_SUM
+    int maxHops;            // Máximo de saltos, 0 = sin límite
+    int minBandwidth;       // Ancho de banda mínimo por enlace, 0 = sin límite
+
+    PathQuery()
+        : objective(PathObjective::COST), costWeight(1.0), latencyWeight(0.0),
+          maxHops(0), minBandwidth(0) {}
+};
+
+/**
+ * Resultado de una consulta de camino con varias métricas
+ */
+struct PathResult {
+    bool found;
+    long long cost;                // Suma de costos
+    long long latency;             // Suma de latencias
+    int bottleneck;                // Menor ancho de banda del camino
+    std::vector<std::string> path;
+
+    PathResult()
+        : found(false), cost(0), latency(0),
+          bottleneck(std::numeric_limits<int>::max()) {}
+};
+
+/**
+ * Clase PathView - Camino expresado como referencias a los nombres de los
+ * enrutadores guardados en la red, sin copiar las cadenas
+ *
+ * Es válido mientras la red que lo generó no se modifique.
+ */
+class PathView {
+private:
+    std::vector<const std::string*> nodes;
+    int cost;
+
+public:
+    PathView() : cost(0) {}
+    PathView(const std::vector<const std::string*>& n, int c) : nodes(n), cost(c) {}
+
+    size_t size() const { return nodes.size(); }
+    const std::string& operator[](size_t i) const { return *nodes[i]; }
+    int getCost() const { return cost; }
+
+    // Copia explícita a nombres, solo cuando se necesita
+    std::vector<std::string> toVector() const {
+        std::vector<std::string> names;
+        for (const std::string* node : nodes) {
+            names.push_back(*node);
+        }
+        return names;
+    }
+};
+
+/**
+ * Estructura que describe un cambio de ruta entre una red bifurcada y su
+ * red de origen (costo -1 indica que no hay ruta)
+ */
+struct RouteChange {
+    std::string source;
+    std::string destination;
+    int oldCost;
+    int newCost;
+    std::vector<std::string> newPath;
+};
+
 /**
  * Clase Network - Representa una red de enrutadores interconectados
+ *
+ * Todo el estado se comparte con copia en escritura: fork() crea una red
+ * hija que comparte topología y tablas con la original y solo duplica lo
+ * que modifica (filas de la topología o de métricas, enrutadores y tablas
+ * de áreas). La asignación enrutador -> área se copia entera en su primer
+ * cambio.
  */
 class Network {
+public:
+    // Modo de almacenamiento de las tablas de enrutamiento:
+    // RESIDENT guarda todas las tablas en memoria; STREAMING no guarda
+    // ninguna y calcula las rutas bajo demanda; HIERARCHICAL guarda tablas
+    // dentro de cada área más una red superpuesta de enrutadores de borde
+    enum class TableMode { RESIDENT, STREAMING, HIERARCHICAL };
+
+    // Receptor de rutas para la exportación (origen, destino, entrada)
+    typedef std::function<void(const std::string&, const std::string&,
+                               const RoutingEntry&)> RouteSink;
+
 private:
+    typedef std::map<std::string, int> LinkRow;                 // Vecino -> costo
+    typedef std::map<std::string, CowPtr<LinkRow>> LinkTable;   // Enrutador -> enlaces
+    typedef std::map<std::string, CowPtr<Router>> RouterTable;
+    typedef std::map<std::string, LinkAttributes> AttributeRow;
+    typedef std::map<std::string, CowPtr<AttributeRow>> AttributeTable;
+
     // Mapa de enrutadores: nombre -> objeto Router
-    std::map<std::string, Router*> routers;
+    CowPtr<RouterTable> routers;
 
     // Matriz de adyacencia: representa la topología de la red
     // topology[router1][router2] = costo del enlace directo
-    std::map<std::string, std::map<std::string, int>> topology;
+    CowPtr<LinkTable> topology;
+
+    // Latencia y ancho de banda por enlace; si falta, se usan los valores
+    // por defecto de LinkAttributes (latencia igual al costo)
+    CowPtr<AttributeTable> linkAttributes;
+
+    TableMode tableMode;
+
+    // Topología por índices para el motor de caminos mínimos
+    struct IndexedTopology {
+        IndexedGraph graph;
+        std::vector<std::string> names;        // Índice -> nombre (en orden)
+        std::map<std::string, int> indices;    // Nombre -> índice
+    };
+
+    // Enrutamiento jerárquico por áreas
+    struct AreaTables {
+        // Caminos mínimos sin salir del área: origen -> destino -> ...
+        std::map<std::string, std::map<std::string, int>> distances;
+        std::map<std::string, std::map<std::string, std::string>> previous;
+    };
+    struct BorderTree {
+        // Caminos mínimos desde un enrutador de borde, por índice de la red
+        // superpuesta (-1 si no hay camino o no hay predecesor)
+        std::vector<int> distances;
+        std::vector<int> parents;
+    };
+    struct OverlayTables {
+        std::map<int, std::vector<std::string>> borders;   // Enrutadores de borde
+        // Enlaces entre áreas más atajos entre bordes de una misma área
+        LinkTable links;
+        IndexedTopology indexed;                   // Los mismos enlaces por índices
+        std::vector<CowPtr<BorderTree>> trees;     // Un árbol por borde
+    };
+    CowPtr<std::map<std::string, int>> routerAreas;       // Enrutador -> área (se copia entero)
+    // Cada recálculo reemplaza la tabla del área, así las redes bifurcadas
+    // siguen compartiendo las áreas que no cambiaron
+    std::map<int, std::shared_ptr<const AreaTables>> areaTables;
+    CowPtr<OverlayTables> overlay;
+    std::set<int> dirtyAreas;      // Áreas a recalcular en la próxima actualización
+    std::set<int> dirtyBorderAreas; // Áreas cuyos enlaces hacia otras áreas cambiaron
+    bool areasNeedRebuild;         // Recalcular todas las áreas
+
+    // Carga por lotes en curso (archivo o red aleatoria): las tablas y las
+    // áreas se calculan una sola vez, al terminar la carga
+    bool batchLoading;
+
+    // Las tablas residentes no son las de un cálculo completo (failLink()
+    // conmutó a respaldos): el próximo cambio las recalcula todas
+    bool routesNeedRebuild;
+
+    // Umbral para usar el motor denso (Floyd-Warshall) en lugar de V Dijkstra
+    static constexpr double DENSE_LINK_DENSITY = 0.25;
+
+    // Copia solo para fork()
+    Network(const Network& other) = default;
+    Network& operator=(const Network&) = delete;
+
+    // Acceso a los datos compartidos (las versiones mutables copian si hace falta)
+    const LinkRow& linksOf(const std::string& name) const;
+    LinkRow& mutableLinksOf(const std::string& name);
+    const Router& routerOf(const std::string& name) const;
+    Router& mutableRouter(const std::string& name);
+    const AttributeRow& attributesOf(const std::string& name) const;
+    void eraseLinkAttributes(const std::string& router1, const std::string& router2);
+    void replaceRoutingTable(Router table);
 
     // Métodos auxiliares privados
-    void dijkstra(const std::string& source);
+    void dijkstra(const IndexedTopology& indexed, ShortestPathSolver& solver, int source);
+    IndexedTopology indexTopology(const LinkTable& graph) const;
+    IndexedTopology indexTopology(const LinkTable& graph,
+                                  const std::vector<std::string>& names) const;
+    void shortestPathTree(const std::string& source,
+                          std::map<std::string, int>& distances,
+                          std::map<std::string, std::string>& previous) const;
+    void shortestPathTree(const IndexedTopology& indexed,
+                          ShortestPathSolver& solver,
+                          const std::string& source,
+                          std::map<std::string, int>& distances,
+                          std::map<std::string, std::string>& previous) const;
+    void updateAllRoutingTablesDense(const IndexedTopology& indexed);
+    void updateRoutingTablesForLink(const std::string& router1, const std::string& router2,
+                                    int oldCost, int newCost);
+    bool isRouteAffected(const Router& table, const std::string& from,
+                         const std::string& to, int oldCost, int newCost) const;
+    double getLinkDensity() const;
     std::vector<std::string> reconstructPath(
         const std::map<std::string, std::string>& previous,
         const std::string& source,
         const std::string& destination) const;
+    void computeBackupRoutes();
+    void computeBackupRoutes(const std::string& source, bool checkPaths);
+    Router buildRoutingTable(const std::string& source) const;
+    LinkAttributes getLinkAttributes(const std::string& router1,
+                                     const std::string& router2) const;
+    void assignAreasByRegionGrowing(int numAreas);
+    void assignRouterArea(const std::string& name, int area);
+    void markLinkAreasDirty(const std::string& router1, const std::string& router2);
+    void updateHierarchicalTables();
+    void computeAreaTables(int area, const std::vector<std::string>& members);
+    void updateOverlay(const std::map<int, std::vector<std::string>>& changedAreas);
+    int getIntraAreaCost(const std::string& source, const std::string& destination) const;
+    std::vector<std::string> getIntraAreaPath(const std::string& source,
+                                              const std::string& destination) const;
+    bool findHierarchicalRoute(const std::string& source, const std::string& destination,
+                               int& cost, std::string& exitBorder,
+                               std::string& entryBorder) const;
+    bool spurSearch(const std::string* spur, const std::string* destination,
+                    const std::set<const std::string*>& blockedNodes,
+                    const std::set<std::pair<const std::string*, const std::string*>>& blockedLinks,
+                    const std::map<const std::string*, int>& heuristic,
+                    std::vector<const std::string*>& path, long long& cost) const;
+    PathResult labelSettingSearch(const std::string& source,
+                                  const std::string& destination,
+                                  const PathQuery& query) const;
 
 public:
     // Constructor y destructor
     Network();
     ~Network();
 
+    // Versiones para planificación: bifurcación y diferencias de rutas
+    std::unique_ptr<Network> fork() const;
+    std::vector<RouteChange> diffRoutingTables(const Network& parent) const;
+
     // Gestión de enrutadores
     void addRouter(const std::string& name);
     void removeRouter(const std::string& name);
@@ -42,13 +272,38 @@ public:
     void removeLink(const std::string& router1, const std::string& router2);
     void updateLinkCost(const std::string& router1, const std::string& router2, int newCost);
 
+    void setLinkMetrics(const std::string& router1, const std::string& router2,
+                        int latency, int bandwidth);
+
+    // Falla de enlace con conmutación inmediata a las rutas de respaldo (LFA)
+    void failLink(const std::string& router1, const std::string& router2);
+
     // Actualización de tablas de enrutamiento
     void updateAllRoutingTables();
+    void setTableMode(TableMode mode);
+    TableMode getTableMode() const;
+
+    // Áreas para el enrutamiento jerárquico
+    void partitionIntoAreas(int numAreas);
+    void setRouterArea(const std::string& name, int area);
+    int getRouterArea(const std::string& name) const;
+
+    // Exportación en streaming: cada tabla se calcula, se envía y se descarta
+    void exportRoutingTables(const RouteSink& sink, int numThreads = 1) const;
+    void exportRoutingTablesToFile(const std::string& filename, int numThreads = 1) const;
 
     // Consultas sobre rutas
     int getPacketCost(const std::string& source, const std::string& destination) const;
     std::vector<std::string> getPacketPath(const std::string& source,
                                            const std::string& destination) const;
+    std::string getBackupNextHop(const std::string& source,
+                                 const std::string& destination) const;
+    std::vector<PathView> getKShortestPaths(const std::string& source,
+                                            const std::string& destination,
+                                            int k) const;
+    PathResult findConstrainedPath(const std::string& source,
+                                   const std::string& destination,
+                                   const PathQuery& query) const;
 
     // Carga desde archivo
     void loadFromFile(const std::string& filename);
@@ -64,6 +319,7 @@ public:
 
     // Getters
     std::vector<std::string> getRouterNames() const;
+    const std::map<std::string, int>& getLinks(const std::string& name) const;
 };
 
 #endif // NETWORK_H
@@ -34,6 +34,32 @@ void Router::clearRoutingTable() {
     routingTable[name] = RoutingEntry(0, selfPath);
 }
 
+void Router::setBackupRoute(const std::string& destination,
+                            const std::string& nextHop, int cost) {
+    auto it = routingTable.find(destination);
+    if (it != routingTable.end()) {
+        it->second.backupNextHop = nextHop;
+        it->second.backupCost = cost;
+    }
+}
+
+void Router::activateBackupRoute(const std::string& destination,
+                                 const std::vector<std::string>& neighborPath) {
+    auto it = routingTable.find(destination);
+    if (it == routingTable.end() || it->second.backupNextHop.empty()) {
+        return;
+    }
+
+    // El nuevo camino es este enrutador seguido del camino del vecino de respaldo
+    std::vector<std::string> newPath = {name};
+    newPath.insert(newPath.end(), neighborPath.begin(), neighborPath.end());
+
+    it->second.cost = it->second.backupCost;
+    it->second.path = newPath;
+    it->second.backupNextHop.clear();
+    it->second.backupCost = -1;
+}
+
 int Router::getCostTo(const std::string& destination) const {
     auto it = routingTable.find(destination);
     if (it != routingTable.end()) {
@@ -54,16 +80,52 @@ bool Router::hasRouteTo(const std::string& destination) const {
     return routingTable.find(destination) != routingTable.end();
 }
 
+bool Router::hasSameRoutes(const Router& other) const {
+    // Compara destinos, costos y caminos (no las rutas de respaldo)
+    if (routingTable.size() != other.routingTable.size()) {
+        return false;
+    }
+    auto it = other.routingTable.begin();
+    for (const auto& entry : routingTable) {
+        if (entry.first != it->first || entry.second.cost != it->second.cost ||
+            entry.second.path != it->second.path) {
+            return false;
+        }
+        ++it;
+    }
+    return true;
+}
+
+std::string Router::getNextHopTo(const std::string& destination) const {
+    auto it = routingTable.find(destination);
+    if (it != routingTable.end() && it->second.path.size() > 1) {
+        return it->second.path[1];
+    }
+    return std::string(); // Sin siguiente salto (destino propio o sin ruta)
+}
+
+std::string Router::getBackupNextHopTo(const std::string& destination) const {
+    auto it = routingTable.find(destination);
+    if (it != routingTable.end()) {
+        return it->second.backupNextHop;
+    }
+    return std::string();
+}
+
 void Router::printRoutingTable() const {
     std::cout << "\n=== Tabla de Enrutamiento de " << name << " ===" << std::endl;
     std::cout << std::setw(15) << "Destino"
               << std::setw(10) << "Costo"
+              << std::setw(12) << "Respaldo"
               << "  Camino" << std::endl;
     std::cout << std::string(60, '-') << std::endl;
 
     for (const auto& entry : routingTable) {
         std::cout << std::setw(15) << entry.first
-                  << std::setw(10) << entry.second.cost << "  ";
+                  << std::setw(10) << entry.second.cost
+                  << std::setw(12)
+                  << (entry.second.backupNextHop.empty() ? "-" : entry.second.backupNextHop)
+                  << "  ";
 
         // Imprimir el camino
         for (size_t i = 0; i < entry.second.path.size(); ++i) {
@@ -13,8 +13,13 @@ struct RoutingEntry {
     int cost;                      // Costo total para llegar al destino
     std::vector<std::string> path; // Camino completo desde origen hasta destino
 
-    RoutingEntry() : cost(std::numeric_limits<int>::max()) {}
-    RoutingEntry(int c, const std::vector<std::string>& p) : cost(c), path(p) {}
+    // Siguiente salto de respaldo (loop-free alternate), vacío si no existe
+    std::string backupNextHop;
+    int backupCost;                // Costo total usando el salto de respaldo
+
+    RoutingEntry() : cost(std::numeric_limits<int>::max()), backupCost(-1) {}
+    RoutingEntry(int c, const std::vector<std::string>& p)
+        : cost(c), path(p), backupCost(-1) {}
 };
 
 /**
@@ -40,10 +45,19 @@ public:
     void removeRoute(const std::string& destination);
     void clearRoutingTable();
 
+    // Métodos para las rutas de respaldo (LFA)
+    void setBackupRoute(const std::string& destination,
+                        const std::string& nextHop, int cost);
+    void activateBackupRoute(const std::string& destination,
+                             const std::vector<std::string>& neighborPath);
+
     // Métodos de consulta
     int getCostTo(const std::string& destination) const;
     std::vector<std::string> getPathTo(const std::string& destination) const;
     bool hasRouteTo(const std::string& destination) const;
+    bool hasSameRoutes(const Router& other) const;
+    std::string getNextHopTo(const std::string& destination) const;
+    std::string getBackupNextHopTo(const std::string& destination) const;
 
     // Método para imprimir la tabla de enrutamiento
     void printRoutingTable() const;
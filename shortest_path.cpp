@@ -0,0 +1,132 @@
+#include "shortest_path.h"
+
+namespace {
+
+// Con costos de enlace hasta este valor el anillo de Dial es pequeño y
+// recorrer cubetas vacías cuesta menos que mantener un montículo
+const int DIAL_MAX_LINK_COST = 256;
+
+template <typename Cost>
+std::unique_ptr<ShortestPathSolver> makeKernel(const IndexedGraph& graph, const char* heapName,
+                                               const char* dialName) {
+    if (graph.maxLinkCost <= DIAL_MAX_LINK_COST) {
+        return std::unique_ptr<ShortestPathSolver>(
+            new ShortestPathKernel<Cost, BucketQueue>(graph, dialName));
+    }
+    return std::unique_ptr<ShortestPathSolver>(
+        new ShortestPathKernel<Cost, BinaryHeapQueue>(graph, heapName));
+}
+
+} // namespace
+
+std::unique_ptr<ShortestPathSolver> makeShortestPathSolver(const IndexedGraph& graph) {
+    // Ningún camino mínimo pasa por más de V - 1 enlaces; el valor máximo
+    // de cada tipo queda reservado como infinito
+    unsigned long long longestPath =
+        static_cast<unsigned long long>(graph.maxLinkCost) *
+        static_cast<unsigned long long>(graph.size() > 0 ? graph.size() - 1 : 0);
+
+    if (longestPath < std::numeric_limits<uint16_t>::max()) {
+        return makeKernel<uint16_t>(graph, "uint16/montículo", "uint16/Dial");
+    }
+    if (longestPath < std::numeric_limits<uint32_t>::max()) {
+        return makeKernel<uint32_t>(graph, "uint32/montículo", "uint32/Dial");
+    }
+    return makeKernel<uint64_t>(graph, "uint64/montículo", "uint64/Dial");
+}
+
+bool isTreeAffected(const std::vector<LinkChange>& changes,
+                    const std::vector<int>& distances, const std::vector<int>& parents) {
+    for (const LinkChange& change : changes) {
+        bool lost = change.oldCost >= 0 &&
+                    (change.newCost < 0 || change.newCost > change.oldCost) &&
+                    parents[change.to] == change.from;
+        bool shorter = change.newCost >= 0 &&
+                       (change.oldCost < 0 || change.newCost < change.oldCost) &&
+                       distances[change.from] >= 0 &&
+                       (distances[change.to] < 0 ||
+                        static_cast<long long>(distances[change.from]) + change.newCost <
+                            distances[change.to]);
+        if (lost || shorter) return true;
+    }
+    return false;
+}
+
+void repairShortestPathTree(const IndexedGraph& graph, const std::vector<LinkChange>& changes,
+                            std::vector<int>& distances, std::vector<int>& parents) {
+    const int numNodes = graph.size();
+
+    // Estado de cada nodo: 0 sin revisar, 1 conserva su camino, 2 lo perdió
+    // (su enlace en el árbol, o el de un antecesor, se eliminó o encareció)
+    std::vector<char> state(numNodes, 0);
+    bool anyLost = false;
+    for (const LinkChange& change : changes) {
+        if (change.oldCost >= 0 && (change.newCost < 0 || change.newCost > change.oldCost) &&
+            parents[change.to] == change.from) {
+            state[change.to] = 2;
+            anyLost = true;
+        }
+    }
+
+    BinaryHeapQueue<long long> queue(0);
+    auto improve = [&](int node, int parent, long long cost) {
+        if (cost > std::numeric_limits<int>::max()) return;
+        if (distances[node] < 0 || cost < distances[node]) {
+            distances[node] = static_cast<int>(cost);
+            parents[node] = parent;
+            queue.push(cost, node);
+        }
+    };
+
+    if (anyLost) {
+        std::vector<int> chain;
+        for (int node = 0; node < numNodes; ++node) {
+            int current = node;
+            while (state[current] == 0 && parents[current] >= 0) {
+                chain.push_back(current);
+                current = parents[current];
+            }
+            if (state[current] == 0) state[current] = 1; // Origen o sin camino
+            for (int visited : chain) state[visited] = state[current];
+            chain.clear();
+        }
+
+        // Los nodos sin camino parten del mejor vecino que conserva el suyo
+        for (int node = 0; node < numNodes; ++node) {
+            if (state[node] == 2) {
+                distances[node] = -1;
+                parents[node] = -1;
+            }
+        }
+        for (int node = 0; node < numNodes; ++node) {
+            if (state[node] != 2) continue;
+            for (int e = graph.offsets[node]; e < graph.offsets[node + 1]; ++e) {
+                int neighbor = graph.targets[e];
+                if (state[neighbor] == 1 && distances[neighbor] >= 0) {
+                    improve(node, neighbor, static_cast<long long>(distances[neighbor]) +
+                                                graph.weights[e]);
+                }
+            }
+        }
+    }
+
+    // Enlaces nuevos o más baratos
+    for (const LinkChange& change : changes) {
+        if (change.newCost >= 0 && (change.oldCost < 0 || change.newCost < change.oldCost) &&
+            distances[change.from] >= 0) {
+            improve(change.to, change.from,
+                    static_cast<long long>(distances[change.from]) + change.newCost);
+        }
+    }
+
+    // Dijkstra solo desde los nodos que cambiaron
+    while (!queue.empty()) {
+        std::pair<long long, int> top = queue.pop();
+        const int current = top.second;
+        if (top.first != distances[current]) continue; // Entrada obsoleta
+
+        for (int e = graph.offsets[current]; e < graph.offsets[current + 1]; ++e) {
+            improve(graph.targets[e], current, top.first + graph.weights[e]);
+        }
+    }
+}
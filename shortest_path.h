@@ -0,0 +1,238 @@
+#ifndef SHORTEST_PATH_H
+#define SHORTEST_PATH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Estructura IndexedGraph - Grafo por índices en formato compacto (CSR)
+ *
+ * Los vecinos del nodo i son targets[offsets[i] .. offsets[i + 1]) con los
+ * costos correspondientes en weights.
+ */
+struct IndexedGraph {
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<int> weights;      // Siempre positivos: el núcleo los pasa a sin signo
+    int maxLinkCost;               // Mayor costo de enlace del grafo
+
+    IndexedGraph() : offsets(1, 0), maxLinkCost(0) {}
+
+    int size() const { return static_cast<int>(offsets.size()) - 1; }
+};
+
+/**
+ * Aritmética de costos: infinito y suma saturada para cada tipo de costo
+ * entero sin signo
+ */
+template <typename Cost>
+struct CostTraits {
+    static_assert(std::is_integral<Cost>::value && std::is_unsigned<Cost>::value,
+                  "Los costos enteros deben ser sin signo");
+
+    static Cost infinity() { return std::numeric_limits<Cost>::max(); }
+
+    // Nunca desborda: el resultado se satura en infinity()
+    static Cost add(Cost a, Cost b) {
+        return a > infinity() - b ? infinity() : static_cast<Cost>(a + b);
+    }
+};
+
+/**
+ * Cola de prioridad por montículo binario; las entradas obsoletas se
+ * descartan al extraerlas
+ */
+template <typename Cost>
+class BinaryHeapQueue {
+private:
+    typedef std::pair<Cost, int> Item;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> heap;
+
+public:
+    explicit BinaryHeapQueue(int /* maxLinkCost */) {}
+
+    bool empty() const { return heap.empty(); }
+    void push(Cost key, int node) { heap.push(Item(key, node)); }
+
+    Item pop() {
+        Item top = heap.top();
+        heap.pop();
+        return top;
+    }
+};
+
+/**
+ * Cola de Dial: un anillo de maxLinkCost + 1 cubetas indexadas por costo.
+ * Las claves pendientes están siempre en [actual, actual + maxLinkCost], así
+ * que la extracción solo recorre cubetas vacías. Solo sirve para costos
+ * enteros pequeños.
+ *
+ * Cada cubeta es un montículo por índice: a igual costo sale el menor
+ * índice, el mismo orden (costo, índice) que BinaryHeapQueue, así que ambas
+ * colas eligen los mismos caminos en los empates.
+ */
+template <typename Cost>
+class BucketQueue {
+    static_assert(std::is_integral<Cost>::value, "La cola de Dial requiere costos enteros");
+
+private:
+    std::vector<std::vector<int>> buckets;
+    Cost current;                  // Menor clave que puede estar pendiente
+    size_t pending;
+
+public:
+    explicit BucketQueue(int maxLinkCost)
+        : buckets(static_cast<size_t>(maxLinkCost) + 1), current(0), pending(0) {}
+
+    bool empty() const { return pending == 0; }
+
+    void push(Cost key, int node) {
+        // Solo al iniciar otra búsqueda llega una clave menor que la actual
+        if (pending == 0 && key < current) current = key;
+        std::vector<int>& bucket = buckets[key % buckets.size()];
+        bucket.push_back(node);
+        std::push_heap(bucket.begin(), bucket.end(), std::greater<int>());
+        ++pending;
+    }
+
+    std::pair<Cost, int> pop() {
+        while (buckets[current % buckets.size()].empty()) {
+            ++current;
+        }
+        std::vector<int>& bucket = buckets[current % buckets.size()];
+        std::pop_heap(bucket.begin(), bucket.end(), std::greater<int>());
+        int node = bucket.back();
+        bucket.pop_back();
+        --pending;
+        return std::make_pair(current, node);
+    }
+};
+
+/**
+ * Clase ShortestPathSolver - Caminos mínimos desde un origen sobre un
+ * IndexedGraph (Dijkstra)
+ *
+ * Las distancias se guardan en el tipo de costo de la instanciación
+ * (ShortestPathKernel); makeShortestPathSolver() elige la más angosta que
+ * no desborda para el grafo dado. Un mismo objeto se reutiliza para varios
+ * orígenes sin volver a reservar memoria.
+ */
+class ShortestPathSolver {
+protected:
+    std::vector<int> parent;       // Predecesor en el árbol, -1 si no hay
+
+public:
+    virtual ~ShortestPathSolver() {}
+
+    // Calcula el árbol de caminos mínimos desde source
+    virtual void solve(int source) = 0;
+
+    // Distancia al nodo en el último árbol, -1 si no es alcanzable
+    virtual long long getDistance(int node) const = 0;
+
+    // Nombre de la instanciación elegida (tipo de costo y cola)
+    virtual const char* getKernelName() const = 0;
+
+    int getParent(int node) const { return parent[node]; }
+
+    std::vector<int> getPath(int node) const {
+        std::vector<int> path;
+        if (getDistance(node) < 0) {
+            return path; // No hay camino
+        }
+        for (int current = node; current >= 0; current = parent[current]) {
+            path.push_back(current);
+        }
+        return std::vector<int>(path.rbegin(), path.rend());
+    }
+};
+
+template <typename Cost, template <typename> class Queue>
+class ShortestPathKernel : public ShortestPathSolver {
+private:
+    typedef CostTraits<Cost> Traits;
+
+    const IndexedGraph& graph;
+    std::vector<Cost> weights;     // Costos de enlace en el tipo del núcleo
+    std::vector<Cost> distances;
+    Queue<Cost> queue;             // Queda vacía al terminar cada solve()
+    const char* name;
+
+public:
+    ShortestPathKernel(const IndexedGraph& g, const char* kernelName)
+        : graph(g), weights(g.weights.begin(), g.weights.end()),
+          distances(g.size(), Traits::infinity()), queue(g.maxLinkCost), name(kernelName) {
+        parent.assign(g.size(), -1);
+    }
+
+    void solve(int source) override {
+        std::fill(distances.begin(), distances.end(), Traits::infinity());
+        std::fill(parent.begin(), parent.end(), -1);
+
+        distances[source] = 0;
+        queue.push(0, source);
+
+        while (!queue.empty()) {
+            std::pair<Cost, int> top = queue.pop();
+            const int current = top.second;
+            if (top.first != distances[current]) continue; // Entrada obsoleta
+
+            for (int e = graph.offsets[current]; e < graph.offsets[current + 1]; ++e) {
+                const int next = graph.targets[e];
+                Cost candidate = Traits::add(top.first, weights[e]);
+                if (candidate < distances[next]) {
+                    distances[next] = candidate;
+                    parent[next] = current;
+                    queue.push(candidate, next);
+                }
+            }
+        }
+    }
+
+    long long getDistance(int node) const override {
+        if (distances[node] == Traits::infinity()) return -1;
+        return static_cast<long long>(distances[node]);
+    }
+
+    const char* getKernelName() const override {
+        return name;
+    }
+};
+
+// Elige el tipo de costo según el mayor camino posible (maxLinkCost * (V - 1))
+// y la cola según maxLinkCost
+std::unique_ptr<ShortestPathSolver> makeShortestPathSolver(const IndexedGraph& graph);
+
+/**
+ * Cambio de costo de un enlace dirigido; -1 indica que el enlace no existía
+ * (enlace nuevo) o que ya no existe (enlace eliminado)
+ */
+struct LinkChange {
+    int from;
+    int to;
+    int oldCost;
+    int newCost;
+};
+
+// Indica si los cambios pueden modificar un árbol de caminos mínimos
+// (distancia y predecesor por nodo, -1 si no hay): el árbol pierde o
+// encarece uno de sus enlaces, o un enlace nuevo o más barato acorta el
+// camino a algún nodo
+bool isTreeAffected(const std::vector<LinkChange>& changes,
+                    const std::vector<int>& distances, const std::vector<int>& parents);
+
+// Corrige el árbol tras los cambios sin recalcularlo entero: solo se visitan
+// los nodos que pierden su camino y los que mejoran. graph ya tiene los
+// costos nuevos y debe ser simétrico. A igual costo el predecesor puede
+// diferir del de un cálculo desde cero.
+void repairShortestPathTree(const IndexedGraph& graph, const std::vector<LinkChange>& changes,
+                            std::vector<int>& distances, std::vector<int>& parents);
+
+#endif // SHORTEST_PATH_H